@@ -206,17 +206,18 @@ void DigitalProcessor::generatePlots__() {
 }
 
 void DigitalProcessor::processPulse__() {
-  auto pulse_data = radar.getData();
-  auto detections = generateRawDetections__(pulse_data);
-  updateClusters__(pulse_data, detections);
+  auto pulse_data = radar.getPooledData(); //the registry is recycled when pulse_data goes out of scope
+  auto detections = generateRawDetections__(*pulse_data);
+  updateClusters__(*pulse_data, detections);
   generatePlots__();
 }
 
 void DigitalProcessor::generate(double max_time) {
   radar.start();
 
+  //sleeps between pulses rather than spinning on dataReady()
   while (radar.getSimTime() < max_time)
-    if (radar.dataReady()) processPulse__();
+    if (radar.waitData(0.01)) processPulse__();
 
   radar.stop();
 }
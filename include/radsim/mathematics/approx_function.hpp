@@ -9,15 +9,24 @@ Intial values are mapped as:
 
 between values x_i and x_(i+1), the function g(x) is linear. 
 
-In order to find i, the values x_(i+1) - x_i are constant. 
+In order to find i, the values x_(i+1) - x_i are constant. Only x_0, the spacing and 
+the values are stored, the entries are generated by getEntryVector.
 
 Use:
 To establish an approxfunction of the function f(x):
 1) Create a std::vector<T> entry of the values of x that are to be calulcated. 
 2) ApproxFunction<T> function = ApproxFunction(entry, value);
 3) T output = function.output(x);
+Many inputs are evaluated with outputInto(input, output), or outputSortedInto if the input is 
+in non-decreasing order.
 
 T can only be continuous values such as double, std::complex<double> or math_vector.
+
+Interpolation::Cubic interpolates with the cubic Hermite (Catmull-Rom) polynomial through the
+four nearest values instead. For smooth functions the error falls as spacing^3 rather than 
+spacing^2, so the same accuracy needs far fewer values. ApproxFunction::sample(func, first, last,
+max_error, interpolation) sizes the table: the number of values is doubled until the table is 
+within max_error of func between all entries.
 */
 
 #ifndef MATHEMATICS_APPROX_FUNCTION2_HPP
@@ -26,6 +35,10 @@ T can only be continuous values such as double, std::complex<double> or math_vec
 #include <vector>
 #include <memory>
 #include <complex>
+#include <span>
+#include <algorithm>
+#include <stdexcept>
+#include <cmath>
 
 #include <radsim/utils/utils.hpp>
 
@@ -33,20 +46,24 @@ T can only be continuous values such as double, std::complex<double> or math_vec
 
 namespace radsim {
 
+enum class Interpolation { Linear, Cubic };
+
 template <class T>
 class ApproxFunction {
 
   private:
+    Interpolation interpolation = Interpolation::Linear;
     int num_values;
-    std::vector<double> entry;
     std::vector<T> value;
-    double diff;
+    double diff;        //spacing of the entries
+    double inv_diff;    //1 / diff
     double first_entry;
     double last_entry;
     T initial_value; //For output, any input below FirstEntry returns this value
     T end_value; //For output, any input above LastEntry returns this value
 
-    bool assertOrderedEntry()
+    //Only the grid of entry is kept, entry[n] = first_entry + n * diff
+    bool assertOrderedEntry(const std::vector<double>& entry)
     {
       bool ordered = true;
       if (entry[1] <= entry.front())
@@ -54,6 +71,7 @@ class ApproxFunction {
       first_entry = entry.front();
       last_entry  = entry.back();
       diff = (last_entry - first_entry + 0.0) / (entry.size() - 1.0);
+      inv_diff = 1 / diff;
       for (int n = 1; n < entry.size(); n++) {
         double cmp = entry[n] - entry[n-1];
         if (!double_equal(cmp, diff, 1e-5))
@@ -68,51 +86,90 @@ class ApproxFunction {
         throw std::invalid_argument(__PRETTY_FUNCTION__ + std::string(": Appproxfunctons can be either double, std::complex<double> or math_vector."));
    }
 
-    void initiate()
+    void initiate(const std::vector<double>& entry)
     {
       assertType();
       if (entry.size() < 2)
         throw std::invalid_argument(__PRETTY_FUNCTION__ + std::string(": Must have at least two entries in entry_arg."));
       if (entry.size() != value.size())
         throw std::invalid_argument(__PRETTY_FUNCTION__ + std::string(": vectors entry and value must be of equal size."));
-      if (!assertOrderedEntry())
+      if (!assertOrderedEntry(entry))
         throw std::invalid_argument(__PRETTY_FUNCTION__ + std::string(": entry_arg not equally spaced."));
     }
 
+    //Catmull-Rom between value[n-1] and value[n], w in [0, 1]. Beyond the table, the missing 
+    //neighbour is extrapolated linearly.
+    T cubic(int n, double w) const
+    {
+      const T& p1 = value[n-1];
+      const T& p2 = value[n];
+      T p0 = n >= 2 ? value[n-2] : 2.0 * p1 - p2;
+      T p3 = n + 1 < num_values ? value[n+1] : 2.0 * p2 - p1;
+      return p1 + 0.5 * w * ((p2 - p0) + w * ((2.0 * p0 - 5.0 * p1 + 4.0 * p2 - p3) + w * (3.0 * (p1 - p2) + (p3 - p0))));
+    }
+
+    static double distance(double a, double b) { return std::abs(a - b); }
+    static double distance(const std::complex<double>& a, const std::complex<double>& b) { return std::abs(a - b); }
+    static double distance(const math_vector& a, const math_vector& b) { return math_vector_length(a - b); }
+
   public:
     ApproxFunction(T value_) :
+      num_values( 1 ),
+      value( {value_} ),
+      diff( 0 ),
+      inv_diff( 0 ),
       first_entry( 0 ),
       last_entry( 0 ),
       initial_value( value_ ),
-      end_value( value_ ),
-      entry( {0} ),
-      value( {value_} )
+      end_value( value_ )
     {
       assertType();
     }
 
     ApproxFunction(std::vector<double> entry_, std::vector<T> value_) :
-      entry( move(entry_) ),
       value( move(value_) )
     {
-      num_values = this->entry.size();
-      initiate();
+      num_values = this->value.size();
+      initiate(entry_);
       this->initial_value = this->value.front();
       this->end_value = this->value.back();
     }
 
-    ApproxFunction(std::vector<double> entry_, std::vector<T> value_, T initial_value, T end_value) :
+    ApproxFunction(std::vector<double> entry_, std::vector<T> value_, T initial_value, T end_value, 
+                   Interpolation interpolation_ = Interpolation::Linear) :
       ApproxFunction(move(entry_), move(value_))
     {
       this->initial_value = initial_value;
       this->end_value = end_value;
+      this->interpolation = interpolation_;
+    }
+
+    //Equally spaced entries from first_entry_ to last_entry_, one per value
+    ApproxFunction(double first_entry_, double last_entry_, std::vector<T> value_, T initial_value, T end_value,
+                   Interpolation interpolation_ = Interpolation::Linear) :
+      interpolation( interpolation_ ),
+      num_values( value_.size() ),
+      value( move(value_) ),
+      first_entry( first_entry_ ),
+      last_entry( last_entry_ ),
+      initial_value( initial_value ),
+      end_value( end_value )
+    {
+      assertType();
+      if (num_values < 2)
+        throw std::invalid_argument(__PRETTY_FUNCTION__ + std::string(": Must have at least two values."));
+      if (last_entry <= first_entry)
+        throw std::invalid_argument(__PRETTY_FUNCTION__ + std::string(": last entry must be greater than first entry."));
+      diff = (last_entry - first_entry) / (num_values - 1.0);
+      inv_diff = 1 / diff;
     }
 
     ApproxFunction(ApproxFunction&& other) :
+       interpolation( other.interpolation ),
        num_values( other.num_values ),
-       entry( move(other.entry) ),
        value( move(other.value) ),
        diff( other.diff ),
+       inv_diff( other.inv_diff ),
        first_entry( other.first_entry ),
        last_entry( other.last_entry ),
        initial_value( other.initial_value ),
@@ -124,14 +181,19 @@ class ApproxFunction {
     ApproxFunction& operator=(const ApproxFunction& other) = default;
 
     T output(double x) const {
-      if (entry.size()) {
+      if (value.size()) {
         if ( x < first_entry )
           return initial_value;
         if ( x >= last_entry )
           return end_value;
-        int n = int((x - first_entry) / diff ) + 1;
-        double w1 = (entry[n] - x) / diff;
-        double w2 = (x - entry[n-1]) / diff;               
+        double u = (x - first_entry) * inv_diff; //entry index of x
+        int n = int(u) + 1;
+        if (n >= num_values)
+          n = num_values - 1; //x rounded into the last interval
+        double w2 = u - (n - 1);
+        if (interpolation == Interpolation::Cubic)
+          return cubic(n, w2);
+        double w1 = 1 - w2;
         return w1 * value[n-1] + w2 * value[n];
       }
       else
@@ -139,23 +201,151 @@ class ApproxFunction {
     }
 
 
-    std::vector<T> outputVector(std::vector<double> input) const 
+    std::vector<T> outputVector(const std::vector<double>& input) const 
     {
-      int size = input.size();
-      std::vector<T> output(size);
-         
-      for (int i = 0; i < size; i++)
-        output[i] = this->output(input[i]);
-
+      std::vector<T> output(input.size());
+      outputInto(input, output);
       return output;
     }
 
-    const std::vector<double>& getEntryVector() const {
+    //output[i] = output(input[i]), without allocation or per-call checks
+    void outputInto(std::span<const double> input, std::span<T> output) const
+    {
+      if (input.size() != output.size())
+        throw std::invalid_argument(__PRETTY_FUNCTION__ + std::string(": input and output must be of equal size."));
+      if (value.empty())
+        throw std::logic_error(__PRETTY_FUNCTION__ + std::string(": cannot use an ApproxFunction that has been moved."));
+      if (num_values < 2 || interpolation == Interpolation::Cubic) {
+        for (size_t i = 0; i < input.size(); i++)
+          output[i] = this->output(input[i]);
+        return;
+      }
+
+      for (size_t i = 0; i < input.size(); i++) {
+        double x = input[i];
+        if (x < first_entry)
+          output[i] = initial_value;
+        else if (x >= last_entry)
+          output[i] = end_value;
+        else {
+          double u = (x - first_entry) * inv_diff; //entry index of x
+          int n = std::min(int(u) + 1, num_values - 1);
+          double w2 = u - (n - 1);
+          output[i] = (1 - w2) * value[n-1] + w2 * value[n];
+        }
+      }
+    }
+
+    //As outputInto, for inputs in non-decreasing order, e.g. a frequency sweep or the times of a 
+    //target path. The table is walked with a cursor, and the slope of an interval is reused by 
+    //all inputs within it. Throws invalid_argument if input is not sorted.
+    void outputSortedInto(std::span<const double> input, std::span<T> output) const
+    {
+      if (input.size() != output.size())
+        throw std::invalid_argument(__PRETTY_FUNCTION__ + std::string(": input and output must be of equal size."));
+      if (value.empty())
+        throw std::logic_error(__PRETTY_FUNCTION__ + std::string(": cannot use an ApproxFunction that has been moved."));
+      if (interpolation == Interpolation::Cubic) {
+        if (!std::is_sorted(input.begin(), input.end()))
+          throw std::invalid_argument(__PRETTY_FUNCTION__ + std::string(": input is not sorted."));
+        outputInto(input, output);
+        return;
+      }
+
+      size_t i = 0;
+      size_t size = input.size();
+      for (; i < size && input[i] < first_entry; i++) {
+        if (i > 0 && input[i] < input[i-1])
+          throw std::invalid_argument(__PRETTY_FUNCTION__ + std::string(": input is not sorted."));
+        output[i] = initial_value;
+      }
+
+      int n = 0; //current interval [entry n, entry n + 1>
+      while (i < size && input[i] < last_entry) {
+        if (i > 0 && input[i] < input[i-1])
+          throw std::invalid_argument(__PRETTY_FUNCTION__ + std::string(": input is not sorted."));
+        double u = (input[i] - first_entry) * inv_diff; //entry index of x
+        if (u >= n + 1)
+          n = std::min(int(u), num_values - 2);
+        T slope = value[n+1] - value[n];
+        do {
+          output[i] = value[n] + (u - n) * slope;
+          i++;
+          if (i == size || input[i] < input[i-1] || input[i] >= last_entry)
+            break;
+          u = (input[i] - first_entry) * inv_diff;
+        } while (u < n + 1);
+      }
+
+      for (; i < size; i++) {
+        if (i > 0 && input[i] < input[i-1])
+          throw std::invalid_argument(__PRETTY_FUNCTION__ + std::string(": input is not sorted."));
+        output[i] = end_value;
+      }
+    }
+
+    //The entries are generated from the grid, the last one equals getLastEntry()
+    std::vector<double> getEntryVector() const {
+      std::vector<double> entry(value.size());
+      for (size_t n = 0; n < entry.size(); n++)
+        entry[n] = first_entry + n * diff;
+      if (entry.size())
+        entry.back() = last_entry;
       return entry;
     }
     const std::vector<T>& getValueVector() const {
       return value;
     }
+    double getFirstEntry() const {
+      return first_entry;
+    }
+    double getLastEntry() const {
+      return last_entry;
+    }
+    T getInitialValue() const {
+      return initial_value;
+    }
+    T getEndValue() const {
+      return end_value;
+    }
+    Interpolation getInterpolation() const {
+      return interpolation;
+    }
+
+    //The smallest table of 2^k + 1 equally spaced values from first_entry_ to last_entry_, 
+    //k <= 20, that is within max_error of func at 8 points between each pair of entries.
+    template <class Func>
+    static ApproxFunction sample(const Func& func, double first_entry_, double last_entry_, 
+                                 double max_error, Interpolation interpolation_, T initial_value, T end_value)
+    {
+      if (!(last_entry_ > first_entry_))
+        throw std::invalid_argument(__PRETTY_FUNCTION__ + std::string(": last entry must be greater than first entry."));
+      if (!(max_error > 0))
+        throw std::invalid_argument(__PRETTY_FUNCTION__ + std::string(": max_error must be positive."));
+
+      for (int k = 2; ; k++) {
+        int size = (1 << k) + 1;
+        double spacing = (last_entry_ - first_entry_) / (size - 1);
+        std::vector<T> value_(size);
+        for (int n = 0; n < size; n++)
+          value_[n] = func(n + 1 < size ? first_entry_ + n * spacing : last_entry_);
+        ApproxFunction table(first_entry_, last_entry_, move(value_), initial_value, end_value, interpolation_);
+        if (k == 20)
+          return table;
+
+        bool within = true;
+        for (int n = 0; n + 1 < size && within; n++)
+          for (int probe = 0; probe < 8; probe++) {
+            double x = first_entry_ + (n + (2 * probe + 1) / 16.0) * spacing;
+            if (distance(table.output(x), func(x)) > max_error) {
+              within = false;
+              break;
+            }
+          }
+        if (within)
+          return table;
+      }
+    }
 
 };
 
@@ -0,0 +1,81 @@
+#include <vector>
+#include <complex>
+#include <memory>
+
+#ifndef MATHEMATICS_FFT_HPP
+#define MATHEMATICS_FFT_HPP
+
+// Discrete fast fourier transform of sampled data, X[k] = sum_n x[n] * exp(-2*pi*i*k*n/N)
+// The inverse transform uses exp(+2*pi*i*k*n/N) and is scaled with 1/N.
+// Arguments:
+// data: N samples, transformed in place. 
+// inverse: an inverse transform is performed.
+//
+// Any N > 0 is allowed. Powers of 2 use an in place radix-2 transform, other sizes a mixed radix 
+// transform over the prime factors of N, with cost N * (sum of the prime factors). 
+//
+// An FFTPlan precomputes the permutation and twiddle factors of a size N, and should be used when 
+// many transforms of the same size are computed. A plan is not modified by execute, and can be 
+// shared between threads. FFTPlan::get(N) returns a cached plan, built once per size.
+//
+// A RealFFTPlan transforms N real samples, N even, to the N/2 + 1 non-negative frequency bins,
+// X[N - k] = conj(X[k]), with one complex transform of size N/2. 
+
+namespace radsim {
+
+class FFTPlan {
+  size_t N;
+  std::vector<size_t> bit_reversal; //power of 2
+  std::vector<std::complex<double>> twiddle; //exp(-2*pi*i*k/N), k < N/2, power of 2
+  std::vector<std::complex<double>> inverse_twiddle; //exp(2*pi*i*k/N), k < N/2, power of 2
+
+  //mixed radix, one stage per prime factor
+  struct Stage {
+    size_t radix;
+    size_t span; //size of the sub-transforms combined by the stage
+    size_t twiddle_offset; //into stage_twiddle, span * (radix - 1) factors
+    size_t root_offset; //into roots, radix factors exp(-2*pi*i*r/radix)
+  };
+  std::vector<Stage> stages;
+  std::vector<std::complex<double>> stage_twiddle;
+  std::vector<std::complex<double>> roots;
+
+  void executeRadix2(std::complex<double> * data, bool inverse) const;
+  void executeMixedRadix(std::complex<double> * data) const;
+
+  public:
+    FFTPlan(size_t N_arg);
+
+    static std::shared_ptr<const FFTPlan> get(size_t N_arg); //cached plan, thread safe
+
+    size_t size() const;
+    void execute(std::complex<double> * data, bool inverse = false) const;
+};
+
+
+class RealFFTPlan {
+  size_t N;
+  std::shared_ptr<const FFTPlan> half_plan;
+  std::vector<std::complex<double>> twiddle; //exp(-2*pi*i*k/N), k <= N/2
+
+  public:
+    RealFFTPlan(size_t N_arg);
+
+    static std::shared_ptr<const RealFFTPlan> get(size_t N_arg); //cached plan, thread safe
+
+    size_t size() const;
+    void execute(const double * input, std::complex<double> * output) const;
+    //input: N samples
+    //output: N/2 + 1 bins
+};
+
+void fft(std::complex<double> * data, size_t N, bool inverse = false);
+void fft(std::vector<std::complex<double>>& data, bool inverse = false);
+std::vector<std::complex<double>> rfft(const std::vector<double>& data); //N/2 + 1 bins, N even
+
+bool   isPowerOfTwo(size_t N);
+size_t nextPowerOfTwo(size_t N); //smallest power of 2 >= N
+
+}
+
+#endif
@@ -6,6 +6,8 @@
 #ifndef MATHEMATICS_FOURIER_H
 #define MATHEMATICS_FOURIER_H
 
+#include <radsim/utils/thread_pool.hpp>
+
 #include <radsim/mathematics/approx_function.hpp>
 
 // These functions create numerically evaluated fourier transform functions G(t) e.g. F(f) = integral(G(t) * exp(-2*pi*i*t*f) dt)
@@ -15,6 +17,11 @@
 // f: argument f in F(f)
 // entry The entries, f, in the resulting tablefunction. 
 // Inverse: an inverse fourier transform is performed. 
+// pool: if given, the entries are evaluated in parallel on the pool.
+//
+// G is sampled once at t_start, t_start + dt ... < t_end, and the phasor exp(-+2*pi*i*t*f) is advanced 
+// from sample to sample by a complex multiplication, re-evaluated exactly every few samples to bound 
+// the rounding error. nonUniformFourierTransform takes any frequencies, e.g. a grid that does not fit an FFT.
 
 namespace radsim {
 
@@ -24,7 +31,21 @@ std::complex<double>  fourierTransformSingle(const ApproxFunction<T>& G, double
 
 template <class T>
 ComplexApproxFunction fourierTransform( const ApproxFunction<T>& G, std::vector<double> entry, 
-                                        double dt, double t_start, double t_end, bool Inverse = false);
+                                        double dt, double t_start, double t_end, bool Inverse = false,
+                                        ThreadPool * pool = NULL);
+
+// Values of F at any frequencies f, not necessarily equally spaced, as for fourierTransform.
+template <class T>
+std::vector<std::complex<double>> nonUniformFourierTransform( const ApproxFunction<T>& G, const std::vector<double>& f, 
+                                                              double dt, double t_start, double t_end, bool Inverse = false,
+                                                              ThreadPool * pool = NULL);
+
+// FFT version of fourierTransform, G is sampled at N points, t_start + n * dt, N even.
+// The entries of the result are f_k = (k - N/2) / (N * dt), k < N, and the values equal those 
+// of fourierTransform with the same entries, dt, t_start and t_end = t_start + N * dt. 
+template <class T>
+ComplexApproxFunction fastFourierTransform( const ApproxFunction<T>& G, size_t N, 
+                                            double dt, double t_start, bool Inverse = false);
 
 }
 
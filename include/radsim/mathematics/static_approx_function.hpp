@@ -0,0 +1,128 @@
+/*
+The StaticApproxFunction is an ApproxFunction of N equally spaced entries with inline storage.
+It is constexpr-constructible, so fixed tables can be generated at compile time, and it needs no
+heap allocation:
+
+constexpr StaticApproxFunction<double, 3> f(-1.0, 1.0, {0.0, 1.0, 0.0}, 0.0, 0.0);
+static_assert( f.output(0.5) == 0.5 );
+
+or, sampling a constexpr function at the entries:
+
+constexpr auto g = StaticApproxFunction<double, 256>::fromFunction(-2.0, 2.0, [](double x) { return x * x; }, 4.0, 4.0);
+
+The output is that of the ApproxFunction with the same entries, values and Interpolation, see 
+toApproxFunction. T can be double or std::complex<double>.
+*/
+
+#ifndef MATHEMATICS_STATIC_APPROX_FUNCTION_HPP
+#define MATHEMATICS_STATIC_APPROX_FUNCTION_HPP
+
+#include <array>
+#include <vector>
+#include <complex>
+#include <string>
+#include <stdexcept>
+#include <type_traits>
+
+#include <radsim/mathematics/approx_function.hpp>
+
+namespace radsim {
+
+template <class T, size_t N>
+class StaticApproxFunction {
+
+  static_assert(N >= 2, "StaticApproxFunction: must have at least two values.");
+  static_assert(std::is_same<T, double>::value or std::is_same<T, std::complex<double> >::value,
+                "StaticApproxFunction: can be either double or std::complex<double>.");
+
+  private:
+    std::array<T, N> value;
+    double first_entry;
+    double last_entry;
+    double inv_diff; //1 / spacing of the entries
+    T initial_value; //For output, any input below first_entry returns this value
+    T end_value; //For output, any input above last_entry returns this value
+    Interpolation interpolation;
+
+    //as ApproxFunction::cubic
+    constexpr T cubic(size_t n, double w) const
+    {
+      const T& p1 = value[n-1];
+      const T& p2 = value[n];
+      T p0 = n >= 2 ? value[n-2] : 2.0 * p1 - p2;
+      T p3 = n + 1 < N ? value[n+1] : 2.0 * p2 - p1;
+      return p1 + 0.5 * w * ((p2 - p0) + w * ((2.0 * p0 - 5.0 * p1 + 4.0 * p2 - p3) + w * (3.0 * (p1 - p2) + (p3 - p0))));
+    }
+
+  public:
+    constexpr StaticApproxFunction(double first_entry_, double last_entry_, const std::array<T, N>& value_, T initial_value_, T end_value_,
+                                   Interpolation interpolation_ = Interpolation::Linear) :
+      value( value_ ),
+      first_entry( first_entry_ ),
+      last_entry( last_entry_ ),
+      inv_diff( (N - 1.0) / (last_entry_ - first_entry_) ),
+      initial_value( initial_value_ ),
+      end_value( end_value_ ),
+      interpolation( interpolation_ )
+    {
+      if (!(last_entry > first_entry))
+        throw std::invalid_argument(__PRETTY_FUNCTION__ + std::string(": last entry must be greater than first entry."));
+    }
+
+    //func is sampled at the entries
+    template <class Func>
+    static constexpr StaticApproxFunction fromFunction(double first_entry_, double last_entry_, Func func, T initial_value_, T end_value_,
+                                                       Interpolation interpolation_ = Interpolation::Linear)
+    {
+      std::array<T, N> value_{};
+      double diff = (last_entry_ - first_entry_) / (N - 1.0);
+      for (size_t n = 0; n < N; n++)
+        value_[n] = func(n + 1 < N ? first_entry_ + n * diff : last_entry_);
+      return StaticApproxFunction(first_entry_, last_entry_, value_, initial_value_, end_value_, interpolation_);
+    }
+
+    constexpr T output(double x) const {
+      if ( x < first_entry )
+        return initial_value;
+      if ( x >= last_entry )
+        return end_value;
+      double u = (x - first_entry) * inv_diff; //entry index of x
+      size_t n = size_t(u) + 1;
+      if (n >= N)
+        n = N - 1; //x rounded into the last interval
+      double w2 = u - (n - 1);
+      if (interpolation == Interpolation::Cubic)
+        return cubic(n, w2);
+      double w1 = 1 - w2;
+      return w1 * value[n-1] + w2 * value[n];
+    }
+
+    constexpr const std::array<T, N>& getValues() const {
+      return value;
+    }
+    constexpr double getFirstEntry() const {
+      return first_entry;
+    }
+    constexpr double getLastEntry() const {
+      return last_entry;
+    }
+    constexpr T getInitialValue() const {
+      return initial_value;
+    }
+    constexpr T getEndValue() const {
+      return end_value;
+    }
+    constexpr Interpolation getInterpolation() const {
+      return interpolation;
+    }
+
+    //A heap copy, with the entries multiplied by entry_scale > 0
+    ApproxFunction<T> toApproxFunction(double entry_scale = 1.0) const {
+      return ApproxFunction<T>(first_entry * entry_scale, last_entry * entry_scale,
+                               std::vector<T>(value.begin(), value.end()), initial_value, end_value, interpolation);
+    }
+};
+
+}
+
+#endif
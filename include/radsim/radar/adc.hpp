@@ -42,6 +42,10 @@ class ADC
 
     unsigned short convertSignal(double power) const; //unit
     //power: W
+
+    short convertAmplitude(double amplitude) const; //unit
+    //amplitude: amp, a signed I or Q component. Linear over [-sqrt(max_power), sqrt(max_power)], 
+    //with num_levels/2 - 1 levels on either side of zero.
 };
 
 }
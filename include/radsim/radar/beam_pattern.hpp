@@ -3,15 +3,47 @@
 #ifndef RADAR_BEAM_SHAPE_HPP
 #define RADAR_BEAM_SHAPE_HPP
 
+#include <radsim/mathematics/mathutils.hpp>
 #include <radsim/mathematics/approx_function.hpp>
+#include <radsim/mathematics/static_approx_function.hpp>
 
 namespace radsim {
 
 enum class BeamPattern{Triangular, Gaussian};
 
+//The patterns at unit beamwidth, func(beamwidths) = unit, generated at compile time.
+//The Gaussian is cubic, within 1e-5 of exact in 129 values (1 kB), as 1000 linear values.
+inline constexpr StaticApproxFunction<double, 3> triangular_beam_pattern(-1.0, 1.0, {0.0, 1.0, 0.0}, 0.0, 0.0);
+
+inline constexpr auto gaussian_beam_pattern = StaticApproxFunction<double, 129>::fromFunction(-2.0, 2.0,
+  [](double u) { return constexprExp(-4.0 * 0.69314718055994531 * u * u); },
+  0.0000152587890625, 0.0000152587890625, //2^-16, the value at -2 and 2 beamwidths
+  Interpolation::Cubic);
+
 DoubleApproxFunction createBeamPattern(BeamPattern Shape, double beamwidth); //func(rad)=unit
 //beamwidth: rad
 
+
+//A pattern scaled to a beamwidth, evaluated directly from the compile time tables
+class BeamShape {
+  private:
+    BeamPattern pattern = BeamPattern::Gaussian;
+    double inv_beamwidth = 1; //1/rad
+
+  public:
+    BeamShape() = default;
+    BeamShape(BeamPattern pattern_arg, double beamwidth); //beamwidth: rad
+
+    double output(double deviation) const //unit
+    //deviation: rad
+    {
+      double u = deviation * inv_beamwidth; //beamwidths
+      if (pattern == BeamPattern::Triangular)
+        return triangular_beam_pattern.output(u);
+      return gaussian_beam_pattern.output(u);
+    }
+};
+
 }
 
 #endif
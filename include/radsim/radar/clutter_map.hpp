@@ -0,0 +1,52 @@
+/*
+Cached clutter texture for compound-Gaussian (K-distributed) clutter.
+
+The clutter power of a range bin is the product of a slowly varying texture and a fast 
+speckle component. The texture is gamma distributed with mean 1 and shape parameter nu, 
+and is fixed per (azimuth cell, range bin). It is generated the first time an azimuth cell
+is illuminated, and kept for the following scans. Only the speckle is drawn per pulse, 
+by the Radar. The amplitude of texture x speckle is K-distributed.
+
+Each azimuth cell is generated from its own seed, so the texture does not depend on 
+the order in which cells are visited.
+*/
+
+#ifndef RADAR_CLUTTER_MAP_HPP
+#define RADAR_CLUTTER_MAP_HPP
+
+#include <vector>
+
+namespace radsim {
+
+class ClutterMap {
+  private:
+    double cell_width; //rad
+    int    num_cells;
+    int    num_range_bins;
+    double shape; //unit, nu
+    unsigned int seed;
+
+    std::vector<std::vector<float>> texture; //[azimuth cell][range bin], empty until first use
+
+    void generateCell(int cell);
+
+  public:
+    ClutterMap(double cell_width_arg, int num_range_bins_arg, double shape_arg, unsigned int seed_arg = 0);
+    //cell_width_arg: rad, width of the azimuth cells
+    //shape_arg: unit, K-distribution shape, small values give spiky clutter
+
+    const float * getTexture(int cell); //unit, texture of all range bins in the cell
+    int    findCell(double theta) const;
+    //theta: rad
+
+    int    getNumCells() const;
+    int    getNumCachedCells() const;
+    double getShape() const; //unit
+
+    void setSeed(unsigned int seed_arg); //clears the cache
+    void clear(); //clears the cache
+};
+
+}
+
+#endif
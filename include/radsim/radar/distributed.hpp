@@ -0,0 +1,48 @@
+/*
+Monte Carlo runs and parameter sweeps distributed over MPI processes.
+
+Only built with ENABLE_MPI, in the library rads_mpi. The caller initializes MPI, and every rank
+of the communicator calls the same function with the same arguments:
+
+MPI_Init(&argc, &argv);
+MonteCarloRunner runner(config, seed);
+MonteCarloResult result = runDistributed(runner, 100000000, generator, detector);
+MPI_Finalize();
+
+Every rank runs a contiguous share of the trials or grid points on its own thread pool.
+Since a trial is seeded from the trial index alone (see MonteCarloRunner), the ranks need no
+seed of their own, and the result is identical for any number of ranks. Monte Carlo counts are
+summed with MPI_Allreduce, sweep tables are gathered in point order with MPI_Allgatherv, and
+every rank returns the complete result.
+
+If a sweep point fails on any rank, all ranks throw: the failing rank its own exception, the
+others a runtime_error.
+
+Test on one machine with e.g. mpirun -np 4 ./program
+*/
+
+#ifndef RADAR_DISTRIBUTED_HPP
+#define RADAR_DISTRIBUTED_HPP
+
+#include <vector>
+#include <string>
+
+#include <mpi.h>
+
+#include <radsim/radar/monte_carlo.hpp>
+#include <radsim/radar/parameter_sweep.hpp>
+
+namespace radsim {
+
+template <class T>
+MonteCarloResult runDistributed(BasicMonteCarloRunner<T>& runner, size_t num_trials,
+                                const typename BasicMonteCarloRunner<T>::TargetGenerator& generator,
+                                const typename BasicMonteCarloRunner<T>::Detector& detector,
+                                MPI_Comm comm = MPI_COMM_WORLD);
+
+SweepTable runDistributed(ParameterSweep& sweep, const ParameterSweep::Metric& metric,
+                          const std::vector<std::string>& metric_names, MPI_Comm comm = MPI_COMM_WORLD);
+
+}
+
+#endif
@@ -0,0 +1,105 @@
+/*
+Coherent (Doppler) processing of I/Q pulses.
+
+The DopplerProcessor collects num_pulses consecutive IQPulseData objects, one coherent
+processing interval (CPI), into a data cube laid out [range bin][pulse], so that the slow-time
+samples of each range bin are contiguous. Incoming pulses arrive in fast-time (range) order,
+so they are staged in small blocks of pulses and transposed into the cube tile by tile.
+
+When a CPI is complete, an FFT across the pulses is computed for every range bin on a 
+thread pool, and a RangeDopplerMap with the power per (range bin, doppler bin) is queued.
+No window is applied to the slow-time samples.
+
+Use:
+DopplerProcessor processor(64, com.getNumRangeBins(), com.getPRT());
+if (processor.consume(com))
+  RangeDopplerMap map = processor.getMap();
+*/
+
+#ifndef RADAR_DOPPLER_PROCESSOR_HPP
+#define RADAR_DOPPLER_PROCESSOR_HPP
+
+#include <vector>
+#include <complex>
+#include <list>
+
+#include <radsim/utils/thread_pool.hpp>
+
+#include <radsim/mathematics/math_vector.hpp>
+#include <radsim/mathematics/fft.hpp>
+
+#include <radsim/radar/pulse_data.hpp>
+#include <radsim/radar/radar_interface.hpp>
+
+namespace radsim {
+
+class RangeDopplerMap {
+  private:
+    double      t_start;   //s, start time of emission of the first pulse
+    double      t_end;     //s, start time of emission of the last pulse
+    math_vector boresight; //unit, mean boresight of the CPI
+    int         num_range_bins;
+    int         num_doppler_bins;
+    double      prt;       //s
+
+  public:
+    RangeDopplerMap(double t_start_arg, double t_end_arg, math_vector boresight_arg, 
+                    int num_range_bins_arg, int num_doppler_bins_arg, double prt_arg);
+
+    std::vector<double> power; //unit, |X|² per [range bin][doppler bin], doppler bins in FFT order
+
+    double      getStartTime() const; //s
+    double      getEndTime() const; //s
+    math_vector getBoresight() const; //unit
+    int         getNumRangeBins() const;
+    int         getNumDopplerBins() const;
+
+    double getPower(int range_bin, int doppler_bin) const; //unit
+    double getDopplerFrequency(int doppler_bin) const; //hz, in [-1/(2 prt), 1/(2 prt)>
+    int    findPeakDopplerBin(int range_bin) const;
+};
+
+
+class DopplerProcessor {
+  private:
+    int    num_pulses;     //pulses per CPI
+    int    num_range_bins;
+    double prt;            //s
+    int    block_size;     //pulses staged before transposing into the cube
+
+    std::vector<std::complex<double>> cube;  //[range bin][pulse]
+    std::vector<std::complex<double>> block; //[pulse][range bin], staging for the transpose
+    int num_in_block;
+    int num_collected;
+
+    double      t_start; //s
+    double      t_end; //s
+    math_vector boresight_sum;
+
+    std::list<RangeDopplerMap> completed;
+    FFTPlan plan;
+    ThreadPool pool;
+
+    static int checkArguments(int num_pulses_arg, int num_range_bins_arg, double prt_arg); //returns num_pulses_arg
+
+    void transposeBlock();
+    void process();
+
+  public:
+    DopplerProcessor(int num_pulses_arg, int num_range_bins_arg, double prt_arg, int num_threads = -1);
+    //num_pulses_arg: pulses per CPI, a power of 2
+    //prt_arg: s
+    //num_threads: worker threads for the FFTs, negative uses all hardware threads
+
+    bool add(const IQPulseData& pulse_data); //returns true if a map is ready
+    bool consume(IQRadarInterface& com); //adds all pulses ready in com, returns true if a map is ready
+    bool ready() const;
+    RangeDopplerMap getMap(); //oldest ready map, check with ready() first
+    void reset(); //discards collected pulses and maps
+
+    int getNumPulses() const;
+};
+
+}
+
+#endif
@@ -0,0 +1,123 @@
+/*
+Monte Carlo estimation of detection and false alarm probabilities.
+
+A MonteCarloRunner runs a number of independent trials of one radar, each trial generating one
+pulse from the targets of a target generator, and passing the pulse to a detector callback.
+The detector returns the number of detections and the number of detection opportunities of the
+trial, e.g. {detected, 1} for a target (a bool converts to this), or the number of threshold
+crossings and the number of tested cells for false alarms.
+
+MonteCarloRunner runner(config);
+MonteCarloResult result = runner.run(1000000,
+                                     [&](size_t trial) { return targets; },
+                                     [&](const PulseData& pulse_data, size_t trial) { return cfar(pulse_data); });
+double pd = result.getProbability();
+auto [low, high] = result.getConfidenceInterval(0.95);
+
+The trials are split into fixed size shards, run on a pool of worker threads with one radar per
+thread. Every trial resets its radar to t = 0, and seeds it from getTrialSeed(seed, trial), so
+the result of a run depends only on the seed, never on the number of threads or the scheduling.
+The radars draw from splitmix64 streams with a 64 bit state, one per trial, unless a custom chaos 
+function is set through setupRadars, which is then kept and seeded per trial. 
+Target generators needing random numbers should derive them from getTrialSeed as well.
+The generator and the detector are called concurrently, and must not throw.
+
+As for the RadarInterface, the runner is parameterized on the sample storage type T:
+MonteCarloRunner (PulseData), ByteMonteCarloRunner (BytePulseData) and IQMonteCarloRunner (IQPulseData).
+*/
+
+#ifndef RADAR_MONTE_CARLO_HPP
+#define RADAR_MONTE_CARLO_HPP
+
+#include <vector>
+#include <memory>
+#include <functional>
+#include <utility>
+#include <cstdint>
+
+#include <radsim/utils/thread_pool.hpp>
+
+#include <radsim/radar/target.hpp>
+#include <radsim/radar/pulse_data.hpp>
+#include <radsim/radar/radar_config.hpp>
+#include <radsim/radar/radar.hpp>
+
+namespace radsim {
+
+struct DetectionCount {
+  unsigned long detections;    //number of detections in the trial
+  unsigned long opportunities; //number of detection opportunities in the trial
+
+  DetectionCount(bool detected);
+  DetectionCount(unsigned long detections_arg, unsigned long opportunities_arg);
+};
+
+
+class MonteCarloResult {
+  private:
+    unsigned long num_trials;
+    unsigned long num_detections;
+    unsigned long num_opportunities;
+
+  public:
+    MonteCarloResult(unsigned long num_trials_arg, unsigned long num_detections_arg, unsigned long num_opportunities_arg);
+
+    unsigned long getNumTrials() const;
+    unsigned long getNumDetections() const;
+    unsigned long getNumOpportunities() const;
+
+    double getProbability() const; //unit, detections / opportunities
+
+    //unit, Wilson score interval of the probability, assuming independent opportunities
+    std::pair<double, double> getConfidenceInterval(double confidence = 0.95) const;
+    //confidence: <0, 1>
+};
+
+
+template <class T>
+class BasicMonteCarloRunner {
+
+  public:
+    typedef std::function<TargetCollection(size_t trial)> TargetGenerator;
+    typedef std::function<DetectionCount(const BasicPulseData<T>& pulse_data, size_t trial)> Detector;
+
+  private:
+    std::vector<std::unique_ptr<Radar>> radars; //one per thread
+    ThreadPool pool;
+    unsigned long seed;
+    size_t shard_size; //trials per shard
+
+  public:
+    BasicMonteCarloRunner(const RadarConfig& config, unsigned long seed_arg = 0, int num_threads = -1);
+    //num_threads: as for ThreadPool, worker threads in addition to the calling thread
+
+    BasicMonteCarloRunner(const BasicMonteCarloRunner& other) = delete;
+    BasicMonteCarloRunner& operator=(const BasicMonteCarloRunner& other) = delete;
+
+    //Applies func to the radar of every thread, e.g. for setToAddClutter or setStaticTargets
+    void setupRadars(const std::function<void(Radar&)>& func);
+
+    void   setSeed(unsigned long seed_arg);
+    unsigned long getSeed() const;
+    void   setShardSize(size_t size); //trials handed to a thread at a time
+    size_t getShardSize() const;
+    int    getNumThreads() const;
+
+    MonteCarloResult run(size_t num_trials, const TargetGenerator& generator, const Detector& detector);
+
+    //Runs trials [first_trial, end_trial> only, e.g. one share of a run split over processes. 
+    //Summing the counts of the shares gives the result of the whole run.
+    MonteCarloResult run(size_t first_trial, size_t end_trial, const TargetGenerator& generator, const Detector& detector);
+
+    //The radar seed of a trial, a splitmix64 state. The streams of trials < 2^32 do not overlap 
+    //within their first 2^32 numbers.
+    static uint64_t getTrialSeed(unsigned long seed, size_t trial);
+};
+
+typedef BasicMonteCarloRunner<unsigned short> MonteCarloRunner;
+typedef BasicMonteCarloRunner<unsigned char>  ByteMonteCarloRunner;
+typedef BasicMonteCarloRunner<short>          IQMonteCarloRunner;
+
+}
+
+#endif
@@ -0,0 +1,99 @@
+/*
+Parameter sweeps over grids of radar configurations.
+
+A ParameterSweep varies numeric keywords of a base RadarConfig over a grid, and evaluates a
+user metric on a radar of every grid point. The keywords and units are those of the config
+file syntax, see RadarConfigParser, e.g. PulseWidth in microsec and NoiseFigure in db.
+
+ParameterSweep sweep(base_config);
+sweep.addAxis("PulseWidth", {0.25, 0.5, 1.0});
+sweep.addAxis("NoiseFigure", {2, 4, 6, 8});
+SweepTable table = sweep.run([](Radar& radar, size_t point) { return vector<double>{ radar.getAvgNoise() }; },
+                             {"AvgNoise"});
+const vector<double>& noise = table.getColumn("AvgNoise");
+
+The points are numbered with the last axis varying fastest. Radars are built and evaluated on a
+pool of worker threads, one point at a time from a shared counter, so threads finishing cheap
+points take on the rest of the grid. Points with equal pulse and beam parameters share their
+bandpass filter, pulse and beam tables, see RadarModel. The metric is called concurrently,
+and must return one value per metric name. If a point fails, the exception of the first failing
+point is rethrown after the sweep.
+
+The result is a SweepTable with one column per axis followed by one column per metric, and one
+row per grid point.
+*/
+
+#ifndef RADAR_PARAMETER_SWEEP_HPP
+#define RADAR_PARAMETER_SWEEP_HPP
+
+#include <vector>
+#include <string>
+#include <functional>
+#include <ostream>
+
+#include <radsim/utils/thread_pool.hpp>
+
+#include <radsim/radar/radar_config.hpp>
+#include <radsim/radar/radar_config_parser.hpp>
+#include <radsim/radar/radar.hpp>
+
+namespace radsim {
+
+class SweepTable {
+  private:
+    std::vector<std::string> names;
+    std::vector<std::vector<double>> columns;
+
+    size_t findColumn(const std::string& name) const;
+
+  public:
+    SweepTable(std::vector<std::string> names_arg, std::vector<std::vector<double>> columns_arg);
+
+    size_t getNumRows() const;
+    size_t getNumColumns() const;
+    const std::vector<std::string>& getColumnNames() const;
+    const std::vector<double>& getColumn(size_t index) const;
+    const std::vector<double>& getColumn(const std::string& name) const;
+
+    void writeCSV(std::ostream& out) const; //header line of column names, one line per row
+};
+
+
+class ParameterSweep {
+
+  public:
+    typedef std::function<std::vector<double>(Radar& radar, size_t point)> Metric;
+
+  private:
+    RadarConfig base_config;
+    RadarConfigParser parser;
+    std::vector<std::string> axis_names;
+    std::vector<std::vector<double>> axis_values;
+    ThreadPool pool;
+
+  public:
+    ParameterSweep(const RadarConfig& base_config_arg, int num_threads = -1);
+    //num_threads: as for ThreadPool, worker threads in addition to the calling thread
+
+    ParameterSweep(const ParameterSweep& other) = delete;
+    ParameterSweep& operator=(const ParameterSweep& other) = delete;
+
+    void addAxis(const std::string& keyword, std::vector<double> values);
+    //values: in units of the config file syntax
+
+    size_t getNumAxes() const;
+    size_t getNumPoints() const;
+    int    getNumThreads() const;
+
+    std::vector<double> getPointValues(size_t point) const; //one value per axis
+    RadarConfig getConfig(size_t point) const;
+
+    SweepTable run(const Metric& metric, const std::vector<std::string>& metric_names);
+
+    //Runs points [first_point, end_point> only, the table has one row per point of the range.
+    SweepTable run(const Metric& metric, const std::vector<std::string>& metric_names, size_t first_point, size_t end_point);
+};
+
+}
+
+#endif
@@ -0,0 +1,54 @@
+/*
+Matched filtering (pulse compression) of I/Q pulses.
+
+The PulseCompressor correlates the I/Q registry of a pulse with the pulse replica of the 
+radar, y[n] = 1/L * sum_m x[n + m] * conj(h[m]), m < L. For an LFM waveform this compresses 
+the echo of a pulse_width long chirp to a peak about 1/chirp_bandwidth wide, in the 
+range bin where the echo starts. The 1/L scaling keeps the amplitude of a full echo.
+
+The correlation is computed by FFT overlap-save. The reference spectrum and the FFT plan 
+are computed once, when the compressor is created for a radar. compress() uses an 
+internal work buffer, so each thread should have its own compressor.
+
+Use:
+PulseCompressor compressor(radar);
+std::vector<std::complex<double>> compressed = compressor.compress( radar.generateIQPulseData(targets) );
+*/
+
+#ifndef RADAR_PULSE_COMPRESSOR_HPP
+#define RADAR_PULSE_COMPRESSOR_HPP
+
+#include <vector>
+#include <complex>
+
+#include <radsim/mathematics/fft.hpp>
+
+#include <radsim/radar/pulse_data.hpp>
+#include <radsim/radar/radar.hpp>
+
+namespace radsim {
+
+class PulseCompressor {
+  private:
+    int    num_range_bins;
+    int    replica_length; //samples, L
+    size_t block_step;     //output samples per overlap-save block
+
+    FFTPlan plan;
+    std::vector<std::complex<double>> reference_spectrum; //conj(FFT(h)) / L
+    std::vector<std::complex<double>> buffer;
+
+  public:
+    PulseCompressor(const Radar& radar);
+
+    void compress(const IQPulseData& pulse_data, std::vector<std::complex<double>>& output);
+    std::vector<std::complex<double>> compress(const IQPulseData& pulse_data);
+    //output: num_range_bins samples, unit
+
+    int    getReplicaLength() const;
+    size_t getFFTSize() const;
+};
+
+}
+
+#endif
@@ -1,6 +1,13 @@
 /*
 This struct stores data from a single pulse emission, and contains the necessary
-information to carry out target data calculations when combined with radar specs. 
+information to carry out target data calculations when combined with radar specs.
+
+The registry is parameterized on the sample storage type T, so that radars with a low
+ADC resolution do not have to carry 16 bit samples:
+
+PulseData     : unsigned short samples, ADC resolution up to 16 bit.
+BytePulseData : unsigned char samples, ADC resolution up to 8 bit.
+IQPulseData   : signed short samples, interleaved I and Q per range bin, [I_0, Q_0, I_1, Q_1 ...].
 */
 
 #ifndef RADAR_PULSE_DATA_HPP
@@ -13,18 +20,19 @@ information to carry out target data calculations when combined with radar specs
 
 namespace radsim {
 
-class PulseData {
+template <class T>
+class BasicPulseData {
   private:
     double      t_start;   //s, start time of emission
-    math_vector boresight; //unit, boresight position of antennae at emission start 
+    math_vector boresight; //unit, boresight position of antennae at emission start
 
-    PulseData * origin_data;
-    unsigned short * origin_reg;
+    BasicPulseData * origin_data;
+    T * origin_reg;
 
   public:
-    PulseData(double t, math_vector boresight_arg, std::vector<unsigned short> registry_arg);
+    BasicPulseData(double t, math_vector boresight_arg, std::vector<T> registry_arg);
 
-    std::vector<unsigned short> registry; //the resultant samplings per range bin.
+    std::vector<T> registry; //the resultant samplings per range bin.
 
     bool isOriginal() const;
     bool hasOriginalRegistry() const;
@@ -33,6 +41,10 @@ class PulseData {
     math_vector getBoresight() const;
 };
 
+typedef BasicPulseData<unsigned short> PulseData;
+typedef BasicPulseData<unsigned char>  BytePulseData;
+typedef BasicPulseData<short>          IQPulseData;
+
 }
 
 #endif
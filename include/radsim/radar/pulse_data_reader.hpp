@@ -3,30 +3,38 @@
 
 #include <fstream>
 
-namespace radsim {  
+#include <radsim/radar/pulse_data.hpp>
 
-class PulseDataReader {
+namespace radsim {
+
+//Reads files created by BasicPulseDataWriter<T>. The sample size stored in the file must match T.
+template <class T>
+class BasicPulseDataReader {
   private:
     std::ifstream in;
     bool is_closed;
 
     void assertNotEndOfFile();
 
-    template <class T>
-    T read() {
-      T num;
+    template <class U>
+    U read() {
+      U num;
       in.read(reinterpret_cast<char *>(&num), sizeof(num));
       assertNotEndOfFile();
       return num;
-    }  
+    }
 
   public:
-    PulseDataReader(const std::string filename);
-    PulseData read();
+    BasicPulseDataReader(const std::string filename);
+    BasicPulseData<T> read();
     bool eof();
     void close();
 };
 
+typedef BasicPulseDataReader<unsigned short> PulseDataReader;
+typedef BasicPulseDataReader<unsigned char>  BytePulseDataReader;
+typedef BasicPulseDataReader<short>          IQPulseDataReader;
+
 }
 
 #endif
@@ -6,6 +6,8 @@
 Filestructure:
 
 File Version                    (int): 4 bytes  (in case structure is changed later)
+Sample Size                     (int): 4 bytes  (bytes per sample, from file version 1)
+Sample Kind                     (int): 4 bytes  (0: unsigned magnitude, 1: signed interleaved I/Q, from file version 2)
 ----------------------------------------------
 For each pulse data object:
 
@@ -13,32 +15,42 @@ Time                    (s)  (double): 8 bytes
 Boresight X            (unit)(double): 8 bytes
 Boresight Y            (unit)(double): 8 bytes
 Boresight Z            (unit)(double): 8 bytes
-Num range bins               (int)   : 4 bytes
-Signals                      (short) : 2 bytes x N bins
+Num range bins               (int)   : 4 bytes  (2 x range bins for I/Q data)
+Signals                      (T)     : Sample Size x N bins
+
+File version 0 has no Sample Size field, and always stores 2 byte samples. Files before
+version 2 have no Sample Kind field, and store magnitude samples.
 */
 
 
 #include <iostream>
 #include <fstream>
 
+#include <radsim/radar/pulse_data.hpp>
+
 namespace radsim {
 
-class PulseDataWriter {
+template <class T>
+class BasicPulseDataWriter {
     std::ofstream ofs;
 
-    template <class T>
-    void write(T number) {
+    template <class U>
+    void write(U number) {
       ofs.write((char *) &number, sizeof number);
     }
 
     bool is_closed;
 
   public:
-    PulseDataWriter(const std::string& filename);
+    BasicPulseDataWriter(const std::string& filename);
     void close();
-    void write(const PulseData& pulse_data);
+    void write(const BasicPulseData<T>& pulse_data);
 };
 
+typedef BasicPulseDataWriter<unsigned short> PulseDataWriter;
+typedef BasicPulseDataWriter<unsigned char>  BytePulseDataWriter;
+typedef BasicPulseDataWriter<short>          IQPulseDataWriter;
+
 }
 
 #endif
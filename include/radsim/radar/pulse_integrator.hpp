@@ -0,0 +1,93 @@
+/*
+Non-coherent integration of pulse registries.
+
+A PulseIntegrator sums the registries of consecutive pulses into wide (unsigned int)
+accumulators, and emits one IntegratedPulseData record when either:
+
+- IntegrationMode::Count        : num_pulses pulses have been summed, or
+- IntegrationMode::AzimuthCell  : the antenna has moved into the next azimuth cell.
+                                  Cells are fixed in azimuth, [0, cell_width>, [cell_width, 2 cell_width> ...
+
+Use:
+PulseIntegrator<unsigned short> integrator(IntegrationMode::Count, 8);
+if (integrator.add(pulse_data))
+  IntegratedPulseData data = integrator.getIntegrated();
+...
+integrator.recycle( std::move(data) );
+
+The registry of a record given back with recycle() is held in a RegistryPool, and reused as the 
+accumulator of a later record. Processing that returns its records makes no allocations in steady state.
+*/
+
+#ifndef RADAR_PULSE_INTEGRATOR_HPP
+#define RADAR_PULSE_INTEGRATOR_HPP
+
+#include <vector>
+#include <list>
+#include <memory>
+
+#include <radsim/mathematics/math_vector.hpp>
+
+#include <radsim/radar/pulse_data.hpp>
+#include <radsim/radar/registry_pool.hpp>
+
+namespace radsim {
+
+enum class IntegrationMode { Count, AzimuthCell };
+
+class IntegratedPulseData {
+  private:
+    double      t_start;    //s, start time of emission of the first pulse
+    double      t_end;      //s, start time of emission of the last pulse
+    math_vector boresight;  //unit, mean boresight of the integrated pulses
+    int         num_pulses; //number of integrated pulses
+
+  public:
+    IntegratedPulseData(double t_start_arg, double t_end_arg, math_vector boresight_arg,
+                        int num_pulses_arg, std::vector<unsigned int> registry_arg);
+
+    std::vector<unsigned int> registry; //the sum of the samplings per range bin.
+
+    double      getStartTime() const; //s
+    double      getEndTime() const; //s
+    math_vector getBoresight() const; //unit
+    int         getNumPulses() const;
+};
+
+
+template <class T>
+class PulseIntegrator {
+  private:
+    IntegrationMode mode;
+    int    num_pulses_max; //pulses per record, Count mode
+    double cell_width;     //rad, AzimuthCell mode
+
+    std::vector<unsigned int> accumulator;
+    math_vector boresight_sum;
+    double t_start; //s
+    double t_end; //s
+    int    num_pulses;
+    int    current_cell;
+
+    std::list<IntegratedPulseData> completed;
+    std::shared_ptr<RegistryPool<unsigned int>> accumulator_pool; //registries of recycled records
+
+    int  findCell(const math_vector& boresight) const;
+    void complete();
+
+  public:
+    PulseIntegrator(IntegrationMode mode_arg, double size, size_t pool_capacity = 16);
+    //size: integral number of pulses (Count) or azimuth cell width in rad (AzimuthCell)
+    //pool_capacity: recycled registries held for reuse
+
+    bool add(const BasicPulseData<T>& pulse_data); //returns true if an integrated record is ready
+    bool ready() const;
+    IntegratedPulseData getIntegrated(); //oldest ready record, check with ready() first
+    void recycle(IntegratedPulseData&& data); //gives the registry of data back for reuse, can be called from any thread
+    void flush(); //completes a partially integrated record, if any
+    void reset(); //discards all integrated data
+};
+
+}
+
+#endif
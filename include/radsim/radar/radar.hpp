@@ -4,6 +4,8 @@
 #include <iostream>
 #include <memory>
 #include <list>
+#include <vector>
+#include <complex>
 
 #include <radsim/utils/rng.hpp>
 
@@ -17,6 +19,9 @@
 #include <radsim/radar/bandpass_filter.hpp>
 #include <radsim/radar/radar_config.hpp>
 #include <radsim/radar/radar_state.hpp>
+#include <radsim/radar/radar_model.hpp>
+#include <radsim/radar/clutter_map.hpp>
+#include <radsim/radar/static_scene_cache.hpp>
 
 namespace radsim {
 
@@ -36,6 +41,10 @@ class Radar
   double elevation_beamwidth; //rad
   double ant_rot_speed; //rad/s
   double init_hor_theta; //rad, pi/2 - azimuth, horizontal pointing direction
+  Waveform waveform; //shape of the emitted pulse modulation
+  double chirp_bandwidth; //hz, frequency sweep of LFM pulses
+  ClutterType clutter_type;
+  double clutter_sigma0; //unit, clutter reflectivity (m2/m2)
 
   //Derived parameters. These are parameters that are calculated based on the primary parameters
   double carrier_wavelength; //m
@@ -46,15 +55,24 @@ class Radar
   double minimum_range; //m
   double range_bin; //m
   int    num_range_bins; //m
+  int    pulse_bin_span; //range bins after the first bin of an echo that receive target signal
+  double chirp_rate; //hz/s, LFM frequency sweep rate
   double minimum_receive_time; //s, shortest time after emission in which
                              //a signal can be received.
   ADC    adc;                //The analog-to-digital converter used in the radar.
-  ComplexApproxFunction bandpass_filter; //func(hz) = unit, Filter used to filter an incoming pulse before sampling.
-  DoubleApproxFunction emitted_pulse; //func(s) = unit, shape of emitted pulse
-  DoubleApproxFunction filtered_pulse;  //func(s) = unit, Filtered returnpulse reflected from a sphere or point
-  DoubleApproxFunction& sim_pulse; //func(s) = unit, the pulse shape used in signal calculations
-  DoubleApproxFunction horizontal_beam_shape; //func(rad) = unit
-  DoubleApproxFunction elevation_beam_shape; //func(rad) = unit
+  std::shared_ptr<const RadarModel> model; //bandpass filter, pulse and beam shapes, shared by identical radars
+  const DoubleApproxFunction * sim_pulse; //func(s) = unit, the pulse shape of model used in signal calculations
+  BeamShape horizontal_beam_shape; //func(rad) = unit, from the compile time pattern tables
+  BeamShape elevation_beam_shape; //func(rad) = unit, from the compile time pattern tables
+  ClutterMap clutter_map; //cached clutter texture per (azimuth cell, range bin)
+  std::vector<double> clutter_power; //W, mean clutter power per range bin
+  std::vector<double> clutter_amplitude; //amp, of clutter_power
+  std::vector<std::complex<double>> speckle_phasors; //unit, table of random speckle phases
+  TargetCollection static_targets; //stationary targets with echoes within unambiguous range, cached
+  TargetCollection static_far_targets; //stationary targets beyond unambiguous range, not cached
+  StaticSceneCache static_cache; //static target echoes per pulse slot within a rotation
+  std::vector<double> signal_I; //amp, per range bin, of the pulse being generated, kept between pulses to reuse the allocation
+  std::vector<double> signal_Q; //amp, per range bin, of the pulse being generated
 
   //Simulation adjustment parameters
   bool to_add_noise; //if true: noise is added to the total signal calculation
@@ -63,6 +81,8 @@ class Radar
   bool use_pdf; //if true: uses pdf functions, if false:  all use of probability density 
                //functions are shut off, returning mean signal instead
   bool to_use_filtered_pulse; //if_true, then bandpass filtered pulse is used, else incoming. 
+  bool to_add_doppler; //if true: the I/Q target phase follows the target range from pulse to pulse, 
+                       //else it is fixed by the target range at t = 0
   double max_sim_distance; //m, no simulation beyond this distance for either clutter, targets, noise nor civilian jamming. 
   double max_sim_receive_time; //s, corresponding to MaxSimDistance
   
@@ -73,7 +93,7 @@ class Radar
   void setDerivedParameters();
   void setAvgNoise();
   void setRangeBins(); 
-  void setFilteredPulse();
+  void setClutterPower();
 
   double  radarEquationPower(double distance, double cross_Section) const; //W, Radar Equation for received power
   //distance: m
@@ -94,6 +114,34 @@ class Radar
           //ReceiveTime: s
           //SignalPower: W
    
+  //Same as setTargetSignal, but with a common phase for all range bins, for coherent (I/Q) signals
+  void    setCoherentTargetSignal(std::vector<double>& TargetSignal_I, std::vector<double>& TargetSignal_Q, double ReceiveTime, double SignalPower, double phase) const;
+          //phase: rad
+
+  //Sets the signal contribution from all targets, including signals carried from previous pulses
+  void    setTargetSignals(std::vector<double>& TargetSignal_I, std::vector<double>& TargetSignal_Q, 
+                           const TargetCollection& targets, bool signal_override, double signal_strength, bool coherent);
+          //coherent: if true, target phase is given by target range, else random per range bin
+
+  //Sets the signal contribution from targets emitted in the current pulse
+  void    addTargetEchoes(std::vector<double>& TargetSignal_I, std::vector<double>& TargetSignal_Q, 
+                          const TargetCollection& targets, bool signal_override, double signal_strength, bool coherent);
+
+  //Adds the cached static target echoes of the current pulse slot, computing the slot if not cached
+  void    addStaticTargetSignals(std::vector<double>& TargetSignal_I, std::vector<double>& TargetSignal_Q, bool coherent);
+  std::vector<StaticEcho> findStaticEchoes() const; //echoes of static_targets at the current antenna direction
+  void    resetStaticCache();
+
+  double  targetPhase(double distance) const; //rad, two-way phase of a target echo
+  //distance: m
+
+  double  chirpPhase(double t) const; //rad, phase modulation of the emitted pulse
+  //t: s, time since start of pulse
+
+  //Adds clutter, texture from the clutter map and speckle drawn per range bin, to the signals
+  void    addClutterSignal(std::vector<double>& Signal_I, std::vector<double>& Signal_Q);
+          //Signal: amp
+
   //Returns a sample of the background white noise from the receiver
   double noise(double Q) const; //W
   //Q: [0, 1>, input to PDF from random number generator
@@ -106,10 +154,16 @@ class Radar
     double    getInstrumentedRange() const; //m
     double    getUnAmbiguousRange() const; //m
     double    getRangeBin() const; //m
+    int       getNumRangeBins() const;
     double    getPeakPower() const; //W
     double    getAvgNoise() const; //W
     double    getPulseWidth() const; //s
     double    getPRT() const; //s
+    double    getCarrierWavelength() const; //m
+    Waveform  getWaveform() const;
+    double    getChirpBandWidth() const; //hz
+    ClutterType getClutterType() const;
+    double    getMeanClutterPower(int bin_index) const; //W, before texture and speckle
     double    getDuplexerSwitchTime() const; //s
     double    getSamplingTime() const; //s, time betweeen samplings, current model uses a fixed formulae
     double    getMaximumReiceiveTime() const; //s
@@ -119,6 +173,7 @@ class Radar
     bool      getToAddTarget() const;
     bool      getUsePdf() const;
     bool      getToUseFilteredPulse() const;
+    bool      getToAddDoppler() const;
     double    getAntRotSpeed() const; //rad/s
     double    getInitialHorTheta() const; //rad, gets the initial horizontal position of the
                                           //     antenna after reset or before any
@@ -128,6 +183,10 @@ class Radar
 
     ADC getADC() const;
     DoubleApproxFunction getFilteredPulse() const; //func(s) = unit, on amp level
+
+    //The emitted pulse modulation sampled at the sampling time, for matched filtering. 
+    //Unit amplitude, length pulse_width / sampling_time.
+    std::vector<std::complex<double>> getPulseReplica() const;
     DoubleApproxFunction getHorizontalBeamShape() const; //func(rad) = unit, on power level
     DoubleApproxFunction getElevationBeamShape() const; //func(rad) = unit, on power level
 
@@ -139,11 +198,26 @@ class Radar
     void setToAddTarget(bool set);
     void setUsePdf(bool set);
     void setToUseFilteredPulse(bool set);
+    void setToAddDoppler(bool set);
+
+    //Stationary targets, e.g. buoys and coastline reflectors, are simulated in addition to the targets 
+    //passed to generatePulseData. Their echoes are computed once per pulse direction and replayed on 
+    //the following rotations. Target positions at t = 0 are used, and signal_override does not apply.
+    void setStaticTargets(TargetCollection targets);
+    void clearStaticTargets();
+    size_t getNumStaticTargets() const;
+    int  getNumStaticCacheSlots() const; //pulse slots within a rotation
+    int  getNumCachedStaticSlots() const;
 
     void setRandomParameters(bool custom, int seed_value, double (*Q_custom)(unsigned int *));
     //if custom: custom seed and chaos functions can be used
     //Q_custom: the custom chaos function. 
 
+    void setRandomParameters(uint64_t seed_value, double (*Q_custom)(uint64_t *));
+    //Q_custom: chaos function with a 64 bit state, e.g. &RNG::splitmix64
+
+    void setRandomSeed(uint64_t seed_value); //keeps the chaos function
+
     void setInitialHorTheta(double theta_arg); 
     //theta_arg: rad
 
@@ -154,12 +228,35 @@ class Radar
 
     //In addition to generating a PulseData object, this functions changes the state of the radai simulation,
     //with regards to time, antennaeposition, and storing of signals beyong unambiuous range.     
-    PulseData generatePulseData(const TargetCollection& targets = {}, bool signal_override = false, double signal_strength = 0);
+    //T: sample storage type, unsigned short (PulseData) or unsigned char (BytePulseData). 
+    //   T must be able to hold every ADC level, else invalid_argument is thrown.
+    //registry_buffer: the registry is written into this buffer, so that a recycled one is not reallocated, see RegistryPool.
+    template <class T = unsigned short>
+    BasicPulseData<T> generatePulseData(const TargetCollection& targets = {}, bool signal_override = false, double signal_strength = 0,
+                                        std::vector<T> registry_buffer = {});
+
+    //Coherent version of generatePulseData. The registry holds interleaved I and Q samples, [I_0, Q_0, I_1, Q_1 ...].
+    //Target phase is set by the two-way target range and carrier wavelength, the noise phase is random.
+    IQPulseData generateIQPulseData(const TargetCollection& targets = {}, bool signal_override = false, double signal_strength = 0,
+                                    std::vector<short> registry_buffer = {});
+
+    //generatePulseData<T>, or generateIQPulseData for T = short, for callers parameterized on the sample type.
+    template <class T = unsigned short>
+    BasicPulseData<T> generate(const TargetCollection& targets = {}, bool signal_override = false, double signal_strength = 0,
+                               std::vector<T> registry_buffer = {});
+
+    //Throws invalid_argument if T cannot hold every ADC level, the signed levels of I/Q samples for T = short.
+    template <class T>
+    void checkSampleType() const;
 
     void reset(double t = 0);
     //t: s
 };
 
+template <>
+IQPulseData Radar::generate<short>(const TargetCollection& targets, bool signal_override, double signal_strength,
+                                   std::vector<short> registry_buffer);
+
 }
 
 #endif
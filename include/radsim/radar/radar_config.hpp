@@ -8,6 +8,13 @@
 
 namespace radsim {
 
+//Rectangular: unmodulated pulse. LFM: linear frequency modulated pulse (chirp), sweeping 
+//chirp_bandwidth over the pulse width, centered at the carrier frequency.
+enum class Waveform { Rectangular, LFM };
+
+//Surface clutter model. None: no clutter is simulated.
+enum class ClutterType { None, Sea, Land };
+
 //This is a container for (non-derived) radar parameters. 
 //It is used as input for radar object initiation. 
 class RadarConfig {
@@ -24,6 +31,11 @@ class RadarConfig {
   double  elevation_beamwidth = 0; //rad, NOT degrees
   double  antennae_gain = 0; //unit, NOT db
   double  theta; //rad, pi/2 - azimuth
+  Waveform waveform = Waveform::Rectangular;
+  double  chirp_bandwidth = 0; //hz, frequency sweep of LFM pulses
+  ClutterType clutter_type = ClutterType::None;
+  double  clutter_sigma0 = -1; //unit, NOT db, clutter reflectivity (m2/m2). Negative: default of the clutter type.
+  double  clutter_shape = -1; //unit, K-distribution shape. Negative: default of the clutter type.
 
   double          antennae_rotation_speed; //rad/s, clockwise is positive
   BeamPattern     horizontal_beam_shape;
@@ -107,6 +119,19 @@ class RadarConfig {
       elevation_beam_shape = pattern;
     }
 
+    void setWaveform(Waveform waveform_arg);
+
+    void setChirpBandWidth(double bandWidth);
+    //bandWidth: Mhz
+
+    void setClutterType(ClutterType type);
+
+    void setClutterSigma0(double sigma0);
+    //sigma0: db
+
+    void setClutterShape(double shape);
+    //shape: unit
+
     void setADCMode(ADCMode adcMode);
     void setADCResolution(int resolution);
     //resolution: bit
@@ -131,6 +156,11 @@ class RadarConfig {
     double getElevationBeamWidth() const; // rad
     double getAntRotSpeed() const; // rad/s
     double getTheta() const; // rad
+    Waveform getWaveform() const;
+    double getChirpBandWidth() const; //hz
+    ClutterType getClutterType() const;
+    double getClutterSigma0() const; //unit
+    double getClutterShape() const; //unit
 
     BeamPattern     getHorizontalBeamShape() const;
     BeamPattern     getElevationBeamShape() const;
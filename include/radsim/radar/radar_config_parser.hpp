@@ -51,6 +51,10 @@ class RadarConfigParser {
 
     RadarConfig parseFile(const std::string& filename) const;
     RadarConfig parseString(const std::string& config_string) const;
+
+    //Sets a numeric keyword of config, with the units of the file syntax. 
+    //Integer keywords must be given an integral value.
+    void setKeyword(RadarConfig& config, const std::string& keyword, double value) const;
     
 };
 
@@ -1,10 +1,26 @@
 /*
 The RadarDataQueue is meant to be used simultaneously be two threads:
 - Radar Simulation thread: pushing data
-- Processing thread: popåing data
+- Processing thread: popping data
 
-The idea is thay both threads work at opposite ends of the queue, and therefore
-usually avoid race conditions. 
+It is a bounded single-producer/single-consumer ring. The slots are allocated once, on
+construction, and the data is moved in and out of them, so pushing and popping make no allocator
+calls. The producer owns the tail index and the consumer the head index, on separate cache lines;
+a push publishes its slot with a release store of the tail, read by the consumer with acquire,
+and the other way around for a pop. Every pushed element can be popped right away.
+
+If the consumer falls behind and the ring is full, push leaves the data untouched, returns false
+and counts an overrun, rather than blocking the simulation.
+
+A consumer that has nothing to do can block in wait(timeout) rather than spin on size(). It spins
+on the tail for a while first, then sleeps on a condition variable. The spin length adapts: it
+grows when data tends to arrive within the spin, and shrinks when the consumer ends up sleeping.
+The producer only takes the lock to notify when the consumer is actually asleep.
+
+All the ready elements can be taken at once with popInto(span) or drain(func, max), with one
+acquire load of the tail and one release store of the head for the whole batch.
+
+The queue is parameterized on the data type it carries, e.g. PulseData or BytePulseData.
 */
 
 #ifndef RADAR_REG_QUEUE_HPP
@@ -12,44 +28,101 @@ usually avoid race conditions.
 
 #include <memory>
 #include <atomic>
+#include <vector>
+#include <optional>
+#include <mutex>
+#include <condition_variable>
+#include <span>
+#include <algorithm>
 
 #include <radsim/radar/pulse_data.hpp>
 
 namespace radsim {
 
-struct DataQueueNode {
-  PulseData data;
-  DataQueueNode * next;
+template <class Data>
+class BasicRadarDataQueue {
 
-  DataQueueNode(PulseData data_arg);
+  static const size_t cache_line = 64; //bytes
 
-};
+  std::vector<std::optional<Data>> slots;
+  size_t mask; //slots.size() - 1, the size is a power of two
+
+  alignas(cache_line) std::atomic<size_t> head; //number of pops, written by the consumer
+  size_t cached_tail; //consumer's last read of tail
 
-class RadarDataQueue {
+  alignas(cache_line) std::atomic<size_t> tail; //number of pushes, written by the producer
+  size_t cached_head; //producer's last read of head
+  std::atomic<size_t> num_overruns;
 
-  DataQueueNode * head;
-  DataQueueNode * tail;
-  std::atomic<size_t> num_nodes;
-  bool pushed_initial;
-  size_t num_nodes_main; //used for counting nodes in the main thread
+  alignas(cache_line) std::atomic<bool> consumer_sleeping;
+  std::mutex wait_mutex;
+  std::condition_variable wait_condition;
+  size_t spin_limit; //consumer's current number of spins before sleeping
 
-  void pop__();
+  static constexpr size_t min_spin_limit = 16;
+  static constexpr size_t max_spin_limit = 16384;
 
+  void notifyConsumer();
 
   public:
-    RadarDataQueue();
-    ~RadarDataQueue();
+    static const size_t default_capacity = 4096;
+
+    BasicRadarDataQueue(size_t capacity = default_capacity); //rounded up to a power of two
+
+    BasicRadarDataQueue(const BasicRadarDataQueue& other) = delete;
+    BasicRadarDataQueue& operator=(const BasicRadarDataQueue& other) = delete;
 
-    PulseData pop(); //One ABOLUTELY has to check with size() before using this function!!!
+    //Producer:
+    bool push( Data&& data ); //false if full, data is then left untouched
 
-    bool isEmpty();
-    void empty(); //empties the dataqueue
-    size_t size(); //the number of elements is equal or greater than the return value
-    void pushInitial( PulseData data );  //Used only if queue is empty
-    void push( PulseData data ); //Cannot be used for initial push, queue cannot be empty
-    
+    //Consumer:
+    Data pop(); //throws logic_error if empty, check with size() or isEmpty() first
+    size_t popInto(std::span<Data> batch); //pops up to batch.size() elements, returns the number popped
+    template <class Func>
+    size_t drain(Func&& func, size_t max = SIZE_MAX); //calls func(Data&&) on up to max elements, in order
+    bool wait(double timeout); //blocks until not empty or timeout, true if not empty
+    //timeout: s
+
+    //Either thread, exact when called from the thread that does not change the queue at the time
+    bool isEmpty() const;
+    size_t size() const;
+
+    void empty(); //empties the dataqueue, only when no other thread uses it
+
+    size_t getCapacity() const;
+    size_t getNumOverruns() const; //pushes refused because the queue was full
 };
 
+//If func throws, the elements up to and including the one it threw on are popped.
+template <class Data>
+template <class Func>
+size_t BasicRadarDataQueue<Data>::drain(Func&& func, size_t max) {
+  size_t h = head.load(std::memory_order_relaxed);
+  cached_tail = tail.load(std::memory_order_acquire);
+  size_t num = std::min(cached_tail - h, max);
+
+  size_t n = 0;
+  try {
+    for (; n < num; n++) {
+      std::optional<Data>& slot = slots[(h + n) & mask];
+      Data data = std::move(*slot);
+      slot.reset();
+      func( std::move(data) );
+    }
+  }
+  catch (...) {
+    head.store(h + n + 1, std::memory_order_release);
+    throw;
+  }
+  head.store(h + num, std::memory_order_release);
+  return num;
+}
+
+
+typedef BasicRadarDataQueue<PulseData>     RadarDataQueue;
+typedef BasicRadarDataQueue<BytePulseData> ByteRadarDataQueue;
+typedef BasicRadarDataQueue<IQPulseData>   IQRadarDataQueue;
+
 }
 
 #endif
@@ -11,6 +11,28 @@ Simulation is started bv:
 com.start() in which data will regularly be inserted into a queue and are readily available. 
 
 com.stop() stops the simulation. 
+
+The processing reads data with dataReady() and getData(), or, to sleep rather than spin while
+waiting for the next pulse, with waitData(timeout) and getDataBlocking(). At high PRFs, every
+ready pulse can be taken at once with getDataBatch(span) or drain(func), see RadarDataQueue.
+
+The pulse registries are generated into buffers from a RegistryPool. getPooledData() returns the
+pulse in a handle that gives the registry back to the pool when destroyed, and a pulse taken by
+the other calls can be given back with recycle(). Processing that returns its registries makes
+no allocations in steady state. Registries that are never returned are freed as usual, and the
+pool allocates new ones.
+
+The queues are bounded, see RadarDataQueue. If the processing falls behind by more than their
+capacity, new data is dropped and counted by getNumOverruns().
+
+If an integration stage is set with com.setIntegration(...), the pulses are integrated
+in the simulation thread, and only the integrated records are queued. These are read with
+integratedDataReady() and getIntegratedData(), and their registries can be given back to the
+integrator with recycleIntegrated().
+
+The interface is parameterized on the sample storage type T of the pulse registries:
+RadarInterface (PulseData) and ByteRadarInterface (BytePulseData). IQRadarInterface queues
+coherent I/Q pulses (IQPulseData) from Radar::generateIQPulseData, and does not support integration.
 */
 
 #ifndef RADAR_INTERFACE_HPP
@@ -19,21 +41,27 @@ com.stop() stops the simulation.
 #include <vector>
 #include <thread>
 #include <atomic>
+#include <span>
 
 #include <radsim/radar/target.hpp>
 #include <radsim/radar/radar_config.hpp>
 #include <radsim/radar/radar_data_queue.hpp>
+#include <radsim/radar/registry_pool.hpp>
+#include <radsim/radar/pulse_integrator.hpp>
 #include <radsim/radar/radar.hpp>
 
 namespace radsim {
 
-class RadarInterface {
+template <class T>
+class BasicRadarInterface {
 
   Radar radar;
   TargetCollection target_collection;
 
   std::thread * sim_thread;
-  RadarDataQueue queue;
+  BasicRadarDataQueue<BasicPulseData<T>> queue;
+  BasicRadarDataQueue<IntegratedPulseData> integrated_queue;
+  std::unique_ptr<PulseIntegrator<T>> integrator; //if set, pulses are integrated before queued
 
   std::atomic<double> sim_time; //s, the "Clock" of the simulator
   std::atomic<bool> allow_send_data; //allows for sending data from sim to process    
@@ -42,20 +70,25 @@ class RadarInterface {
   bool statistics;   //If true, at end of a sim_run, Percentage work time is printed, 
   bool initiated;  //if true, has initiated the sim
   double time_step;    //s, time_step in simulation before updating sim_time;
+  double pacing_slack; //s, the simulation thread busy-waits this long before each deadline, and sleeps until then
   size_t queue_size; //number of elements in queue is at least this number
+  size_t integrated_queue_size; //number of elements in integrated_queue is at least this number
+  std::shared_ptr<RegistryPool<T>> registry_pool; //shared with the handles of getPooledData
 
   //radar parameters
   double min_range; //m
   double range_bin; //m
+  int    num_range_bins;
+  double prt; //s
 
   public:
-    RadarInterface(const RadarConfig& config, TargetCollection target_collection_, double dt = 0.15);
+    BasicRadarInterface(const RadarConfig& config, TargetCollection target_collection_, double dt = 0.15);
     //dt: s, timestep in the simulation, before updating sim_time. 
 
-    RadarInterface(const RadarInterface& other) = delete;
-    RadarInterface& operator=(const RadarInterface& other) = delete;
+    BasicRadarInterface(const BasicRadarInterface& other) = delete;
+    BasicRadarInterface& operator=(const BasicRadarInterface& other) = delete;
 
-    ~RadarInterface();
+    ~BasicRadarInterface();
 
     void setStatistics(bool set);
     //set: if true, A printout of how much simulator thread worked, is printed. Default set = false
@@ -63,6 +96,17 @@ class RadarInterface {
     void setAddNoise(bool set);
     //set: if yes: raadar receiver noise is added to simulation, default is true
 
+    void setPacingSlack(double slack);
+    //slack: s, after each time step the simulation thread sleeps until slack before the wall clock
+    //has caught up, then busy-waits. Larger slack gives more exact pacing at more CPU use. Default 0.5 ms.
+
+    void setIntegration(IntegrationMode mode, double size);
+    //size: number of pulses (Count), or azimuth cell width in rad (AzimuthCell)
+    //Can only be set before the first start, or after reset.
+
+    void clearIntegration();
+    //Pulses are queued without integration, default. 
+
     void start(bool signal_override = false, double signal_strength = 0);
     //signal_override: if yes, then received signal is signal_strength.
     //signal_strength = 0
@@ -74,11 +118,38 @@ class RadarInterface {
     double getSimTime() const; //s
 
     bool dataReady();
-    PulseData getData();
+    BasicPulseData<T> getData();
+    bool waitData(double timeout); //blocks until dataReady() or timeout, returns dataReady()
+    //timeout: s
+    BasicPulseData<T> getDataBlocking(); //waits for the next pulse, throws logic_error if the simulation is not running
+    PooledPulseData<T> getPooledData(); //as getData, the registry returns to the pool when the handle is destroyed
+    void recycle(BasicPulseData<T>&& data); //gives the registry of data back to the pool
+    const RegistryPool<T>& getRegistryPool() const;
+    size_t getDataBatch(std::span<BasicPulseData<T>> batch); //moves up to batch.size() ready pulses into batch, returns the number
+    template <class Func>
+    size_t drain(Func&& func, size_t max = SIZE_MAX); //calls func(BasicPulseData<T>&&) on up to max ready pulses, returns the number
+    bool integratedDataReady();
+    IntegratedPulseData getIntegratedData();
+    void recycleIntegrated(IntegratedPulseData&& data); //gives the registry of data back to the integrator
+    size_t getNumOverruns() const; //pulses or integrated records dropped, since the processing fell behind
     double getRange(int bin_index) const; //m
+    int    getNumRangeBins() const;
+    double getPRT() const; //s
 
 };
 
+template <class T>
+template <class Func>
+size_t BasicRadarInterface<T>::drain(Func&& func, size_t max) {
+  queue_size = 0;
+  return queue.drain(std::forward<Func>(func), max);
+}
+
+
+typedef BasicRadarInterface<unsigned short> RadarInterface;
+typedef BasicRadarInterface<unsigned char>  ByteRadarInterface;
+typedef BasicRadarInterface<short>          IQRadarInterface;
+
 }
 
 #endif
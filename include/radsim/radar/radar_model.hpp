@@ -0,0 +1,76 @@
+/*
+The RadarModel holds the derived tables of a radar that are expensive to build and never change 
+during simulation: the bandpass filter, the emitted and filtered pulse shapes, and the beam shapes.
+
+Models are immutable and shared between Radar instances. RadarModel::get(config) returns the model
+of all configs with the same RadarModelKey, the parameters the tables are derived from, and only 
+builds a new model if no Radar holds one already. Constructing the 100th identical radar then 
+reuses the tables of the first. Across processes, the tables are shared through the on-disk
+RadarModelCache.
+*/
+
+#ifndef RADAR_RADAR_MODEL_HPP
+#define RADAR_RADAR_MODEL_HPP
+
+#include <memory>
+#include <compare>
+
+#include <radsim/mathematics/approx_function.hpp>
+
+#include <radsim/radar/beam_pattern.hpp>
+#include <radsim/radar/radar_config.hpp>
+
+namespace radsim {
+
+struct RadarModelKey {
+  double      pulse_width; //s
+  double      bandwidth; //hz
+  BeamPattern horizontal_beam_pattern;
+  double      horizontal_beamwidth; //rad
+  BeamPattern elevation_beam_pattern;
+  double      elevation_beamwidth; //rad
+
+  RadarModelKey(const RadarConfig& config);
+
+  auto operator<=>(const RadarModelKey& other) const = default;
+};
+
+
+class RadarModel {
+  private:
+    RadarModelKey         key;
+    ComplexApproxFunction bandpass_filter; //func(hz) = unit, filter used on an incoming pulse before sampling
+    DoubleApproxFunction  emitted_pulse; //func(s) = unit, shape of emitted pulse
+    DoubleApproxFunction  filtered_pulse; //func(s) = unit, filtered return pulse reflected from a point target
+    DoubleApproxFunction  horizontal_beam_shape; //func(rad) = unit
+    DoubleApproxFunction  elevation_beam_shape; //func(rad) = unit
+
+    void setFilteredPulse();
+
+  public:
+    RadarModel(const RadarModelKey& key_arg);
+
+    //A model from stored tables, see RadarModelCache
+    RadarModel(const RadarModelKey& key_arg, ComplexApproxFunction bandpass_filter_arg, 
+               DoubleApproxFunction emitted_pulse_arg, DoubleApproxFunction filtered_pulse_arg,
+               DoubleApproxFunction horizontal_beam_shape_arg, DoubleApproxFunction elevation_beam_shape_arg);
+
+    RadarModel(const RadarModel& other) = delete;
+    RadarModel& operator=(const RadarModel& other) = delete;
+
+    //The shared model of the key. If no live model has the same key, it is loaded from the
+    //RadarModelCache, or built and stored there. Thread safe.
+    static std::shared_ptr<const RadarModel> get(const RadarModelKey& key_arg);
+    static int getNumLiveModels(); //models held by at least one owner
+
+    const RadarModelKey&         getKey() const;
+    const ComplexApproxFunction& getBandpassFilter() const; //func(hz) = unit
+    const DoubleApproxFunction&  getEmittedPulse() const; //func(s) = unit
+    const DoubleApproxFunction&  getFilteredPulse() const; //func(s) = unit, on amp level
+    const DoubleApproxFunction&  getHorizontalBeamShape() const; //func(rad) = unit, on power level
+    const DoubleApproxFunction&  getElevationBeamShape() const; //func(rad) = unit, on power level
+};
+
+}
+
+#endif
@@ -0,0 +1,74 @@
+#ifndef RADAR_MODEL_CACHE_HPP
+#define RADAR_MODEL_CACHE_HPP
+
+/*
+On-disk cache of RadarModel tables, shared between processes.
+
+RadarModel::get first looks for a live model, then in the cache directory, and only builds the 
+tables if neither has them. A built model is written to the cache directory. The directory is taken 
+from the environment variable RADSIM_CACHE_DIR, or set with RadarModelCache::setDirectory. 
+The cache is off if no directory is set.
+
+A model is stored in the file radar_model_<hash>.bin, where hash is computed from the RadarModelKey,
+the format version and the library version. The library version is the project version and the
+git revision the build was configured at, so a new build of changed table code does not reuse
+older files. The format version must still be incremented whenever the file structure, or the
+way the tables are computed, is changed without a new revision. Files are read with one read per
+table, and are written to a temporary file and renamed, so that concurrent processes never see
+a partial file.
+
+Filestructure:
+
+Magic                        (char): 8 bytes, "RSMODEL" and 0
+Format version               (int) : 4 bytes
+Library version length       (int) : 4 bytes
+Library version              (char): Library version length
+Pulse width             (s)  (double): 8 bytes
+Bandwidth               (hz) (double): 8 bytes
+Horizontal beam pattern      (int) : 4 bytes
+Horizontal beamwidth    (rad)(double): 8 bytes
+Elevation beam pattern       (int) : 4 bytes
+Elevation beamwidth     (rad)(double): 8 bytes
+----------------------------------------------
+For each table: bandpass filter (complex), emitted pulse, filtered pulse, horizontal beam shape 
+and elevation beam shape (double):
+
+Num entries                  (int) : 4 bytes
+Initial value                (T)   : sizeof(T)
+End value                    (T)   : sizeof(T)
+First entry                  (double): 8 bytes
+Last entry                   (double): 8 bytes
+Interpolation                (int) : 4 bytes
+Values                       (T)   : sizeof(T) x Num entries
+*/
+
+#include <string>
+#include <memory>
+#include <cstdint>
+
+#include <radsim/radar/radar_model.hpp>
+
+namespace radsim {
+
+class RadarModelCache {
+  public:
+    static const int format_version = 4;
+
+    static std::string getLibraryVersion();
+
+    static void setDirectory(const std::string& directory); //empty turns the cache off
+    static std::string getDirectory();
+
+    static uint64_t hash(const RadarModelKey& key);
+    static std::string getFilename(const RadarModelKey& key); //empty if the cache is off
+
+    //The stored model of key, or nullptr if the cache is off, or the file is missing or does not match key.
+    static std::shared_ptr<const RadarModel> load(const RadarModelKey& key);
+
+    //Writes the model to the cache directory, returns false if the cache is off or the file could not be written.
+    static bool store(const RadarModel& model);
+};
+
+}
+
+#endif
@@ -0,0 +1,112 @@
+/*
+A RadarNetwork simulates many radars looking at the same targets.
+
+All radars share one read-only target snapshot, and are run on a fixed pool of worker threads
+instead of one thread per radar. For every time step, only the radars with pulses due are 
+scheduled, each generating the pulses of its own PRT, so the total work follows the number of 
+pulses, not the number of radars. Each radar has its own bounded output queue, see RadarDataQueue.
+
+BasicRadarNetwork<unsigned short> network(make_shared<const TargetCollection>(targets));
+int index = network.addRadar(config);
+network.start();
+if (network.dataReady(index))
+  PulseData pulse_data = network.getData(index);
+network.stop();
+
+Instead of start() and stop(), advance(t) generates all pulses up to time t in the calling thread, 
+with no real time pacing.
+
+As for the RadarInterface, the network is parameterized on the sample storage type T: RadarNetwork 
+(PulseData), ByteRadarNetwork (BytePulseData) and IQRadarNetwork (IQPulseData).
+*/
+
+#ifndef RADAR_NETWORK_HPP
+#define RADAR_NETWORK_HPP
+
+#include <vector>
+#include <memory>
+#include <thread>
+#include <atomic>
+
+#include <radsim/utils/thread_pool.hpp>
+
+#include <radsim/radar/target.hpp>
+#include <radsim/radar/radar_config.hpp>
+#include <radsim/radar/radar_data_queue.hpp>
+#include <radsim/radar/radar.hpp>
+
+namespace radsim {
+
+template <class T>
+class BasicRadarNetwork {
+
+  struct RadarNode {
+    Radar radar;
+    BasicRadarDataQueue<BasicPulseData<T>> queue;
+    size_t queue_size; //number of elements in queue is at least this number
+
+    RadarNode(const RadarConfig& config);
+  };
+
+  std::shared_ptr<const TargetCollection> targets;
+  std::vector<std::unique_ptr<RadarNode>> nodes;
+  ThreadPool pool;
+
+  std::thread * sim_thread;
+  std::atomic<double> sim_time; //s, the "Clock" of the simulator
+  std::atomic<bool> on;         //on tells the scheduler to continue running
+
+  bool   initiated; //if true, the first pulse of every radar is queued
+  double time_step; //s, time step in simulation before updating sim_time
+
+  void initiate();
+  void runPulses(double t_end);
+  //t_end: s, pulses starting before t_end are generated
+
+  void schedulerLoop();
+
+  public:
+    BasicRadarNetwork(std::shared_ptr<const TargetCollection> targets_arg, int num_threads = -1, double dt = 0.01);
+    //num_threads: worker threads in addition to the scheduler thread, negative gives hardware_concurrency - 1
+    //dt: s, time step in the simulation, before updating sim_time
+
+    BasicRadarNetwork(const BasicRadarNetwork& other) = delete;
+    BasicRadarNetwork& operator=(const BasicRadarNetwork& other) = delete;
+
+    ~BasicRadarNetwork();
+
+    int addRadar(const RadarConfig& config); //returns the index of the radar
+    //Radars can only be added before the first start, or after reset.
+
+    void setTargets(std::shared_ptr<const TargetCollection> targets_arg);
+    //Cannot be set when the simulation is running. 
+
+    void setAddNoise(bool set);
+    //set: if yes, radar receiver noise is added to the simulation of all radars, default is true
+
+    void start();
+    void stop();
+    void reset(double t = 0);
+    //t: s
+
+    void advance(double t);
+    //t: s, generates the pulses of all radars starting before t, without pacing. 
+    //Cannot be used when the simulation is running. 
+
+    double getSimTime() const; //s
+    int    getNumRadars() const;
+    int    getNumThreads() const;
+    const Radar& getRadar(int index) const;
+
+    bool dataReady(int index);
+    BasicPulseData<T> getData(int index);
+    size_t getNumOverruns(int index) const; //pulses of radar index dropped, since the processing fell behind
+};
+
+typedef BasicRadarNetwork<unsigned short> RadarNetwork;
+typedef BasicRadarNetwork<unsigned char>  ByteRadarNetwork;
+typedef BasicRadarNetwork<short>          IQRadarNetwork;
+
+}
+
+#endif
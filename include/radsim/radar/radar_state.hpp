@@ -17,8 +17,9 @@ struct PulseCarry {
   double time; //s
   double power; //s
   math_vector pos; //[m,m,m]
+  double phase; //rad, target phase for coherent signals
 
-  PulseCarry(double time_arg, double power_arg, const math_vector& pos_arg);
+  PulseCarry(double time_arg, double power_arg, const math_vector& pos_arg, double phase_arg = 0);
 
 };
 
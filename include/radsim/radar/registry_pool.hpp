@@ -0,0 +1,85 @@
+/*
+The RegistryPool recycles pulse registry buffers between the simulation thread, which fills them,
+and the processing thread, which is done with them. Without it, every pulse allocates a registry
+in one thread and frees it in the other.
+
+auto pool = std::make_shared<RegistryPool<unsigned short>>(capacity);
+std::vector<unsigned short> buffer = pool->acquire(); //a recycled buffer, or an empty one
+...
+pool->release( std::move(buffer) );
+
+The pool has a fixed number of slots. Each slot is on one of two lock-free stacks, the slots that
+hold a buffer and the slots that are free. acquire takes a buffer from a held slot and puts the
+slot on the free stack, release does the opposite, so neither allocates. If no buffer is held,
+acquire returns an empty vector, and if no slot is free, release lets the buffer go. In steady
+state the pool holds about as many buffers as are in flight, and makes no allocations.
+
+The stack heads pack a slot index with a counter that changes on every update, so that a slot
+that is popped and pushed back between the load and the compare-exchange of another thread is
+noticed (the ABA problem). Both acquire and release can be called from any thread.
+
+A PooledPulseData owns a pulse and returns its registry to the pool when destroyed.
+*/
+
+#ifndef RADAR_REGISTRY_POOL_HPP
+#define RADAR_REGISTRY_POOL_HPP
+
+#include <memory>
+#include <atomic>
+#include <vector>
+#include <cstdint>
+
+#include <radsim/radar/pulse_data.hpp>
+
+namespace radsim {
+
+template <class T>
+class RegistryPool {
+
+  static const uint32_t null_index = UINT32_MAX;
+
+  std::vector<std::vector<T>> buffers;
+  std::vector<std::atomic<uint32_t>> next; //the slot below on the same stack
+
+  std::atomic<uint64_t> held_head; //slots holding a buffer, [counter, index]
+  std::atomic<uint64_t> free_head; //slots without a buffer, [counter, index]
+
+  std::atomic<size_t> num_misses;
+
+  uint32_t pop(std::atomic<uint64_t>& stack_head);
+  void push(std::atomic<uint64_t>& stack_head, uint32_t index);
+
+  public:
+    RegistryPool(size_t capacity); //maximum number of buffers held
+
+    RegistryPool(const RegistryPool& other) = delete;
+    RegistryPool& operator=(const RegistryPool& other) = delete;
+
+    std::vector<T> acquire(); //a recycled buffer, or an empty vector if none is held
+    void release(std::vector<T>&& buffer); //buffer is held for reuse, or freed if the pool is full
+
+    size_t getCapacity() const;
+    size_t getNumMisses() const; //acquire calls that found no buffer
+};
+
+
+template <class T>
+class PooledPulseData {
+  BasicPulseData<T> data;
+  std::shared_ptr<RegistryPool<T>> pool;
+
+  public:
+    PooledPulseData(BasicPulseData<T>&& data_arg, std::shared_ptr<RegistryPool<T>> pool_arg);
+    PooledPulseData(PooledPulseData&& other) = default;
+    PooledPulseData& operator=(PooledPulseData&& other);
+    ~PooledPulseData(); //the registry goes back to the pool
+
+    BasicPulseData<T>& operator*() { return data; }
+    const BasicPulseData<T>& operator*() const { return data; }
+    BasicPulseData<T> * operator->() { return &data; }
+    const BasicPulseData<T> * operator->() const { return &data; }
+};
+
+}
+
+#endif
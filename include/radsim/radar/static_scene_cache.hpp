@@ -0,0 +1,62 @@
+/*
+Scan-to-scan cache of the echoes from stationary targets.
+
+A target that does not move gives the same mean echo every time the antenna points in the
+same direction. The cache holds, per pulse slot within a rotation, the sparse range bin 
+contributions of all static targets: one StaticEcho per (target, range bin). The Radar 
+computes a slot the first time the antenna visits it, and replays it on the following 
+rotations with only a fresh random phase applied (non-coherent), or as is (coherent).
+
+Pulse slots are spaced by the antenna rotation per pulse, prt * ant_rot_speed, starting from
+the initial antenna direction. The antenna direction is taken relative to the initial one, within
+a rotation, so the slots stay fixed in direction over any number of rotations, in either sense.
+If a rotation is not an integer number of pulses, a pulse uses the nearest slot, within half a 
+pulse step. With a fixed antenna there is a single slot.
+*/
+
+#ifndef RADAR_STATIC_SCENE_CACHE_HPP
+#define RADAR_STATIC_SCENE_CACHE_HPP
+
+#include <vector>
+#include <complex>
+
+namespace radsim {
+
+struct StaticEcho {
+  int    bin; //range bin index
+  double amplitude; //amp, of the echo in the range bin
+  std::complex<double> phasor; //amp, amplitude with the coherent echo phase
+
+  StaticEcho(int bin_arg, double amplitude_arg, std::complex<double> phasor_arg);
+};
+
+
+class StaticSceneCache {
+  private:
+    double step; //rad, antenna rotation per pulse
+    double init_theta; //rad, antenna direction of slot 0
+    int    num_slots;
+
+    std::vector<std::vector<StaticEcho>> echoes; //[slot]
+    std::vector<bool> cached; //[slot]
+
+  public:
+    StaticSceneCache(double step_arg = 0, double init_theta_arg = 0);
+    //step_arg: rad, antenna rotation per pulse
+    //init_theta_arg: rad
+
+    int  findSlot(double theta) const;
+    //theta: rad, antenna direction
+
+    bool isCached(int slot) const;
+    const std::vector<StaticEcho>& getEchoes(int slot) const;
+    void setEchoes(int slot, std::vector<StaticEcho> slot_echoes);
+
+    int  getNumSlots() const;
+    int  getNumCachedSlots() const;
+    void clear(); //clears the cache
+};
+
+}
+
+#endif
@@ -5,16 +5,22 @@
 #include <iostream>
 #include <memory>
 #include <list>
+#include <atomic>
+#include <optional>
 
 #include <radsim/mathematics/math_vector.hpp>
 #include <radsim/mathematics/approx_function.hpp>
 
+#include <radsim/radar/trajectory.hpp>
+
 namespace radsim {
 
 class Target
 {
 
-  VectorApproxFunction path; //func(s) = [m, m, m]
+  std::optional<VectorApproxFunction> path; //func(s) = [m, m, m], set unless the target follows a trajectory
+  std::shared_ptr<const Trajectory> trajectory; //if set, the path of the target, shared by copies
+  mutable std::atomic<size_t> trajectory_cursor; //segment of the last trajectory lookup, of this copy
   double RCS;
 
   public:
@@ -26,16 +32,23 @@ class Target
     //path: func(s) = [m, m, m]
     //rcs_: m2
 
+    Target(Trajectory trajectory, double rcs);
+    //trajectory: m
+    //rcs: m2
+
     Target(Target&& other);
-    Target(const Target& other) = default;
-    Target& operator=(const Target& other) = default;
+    Target(const Target& other);
+    Target& operator=(const Target& other);
 
     ~Target();
 
     math_vector getPosition(double t = 0) const; //m
     //t: s, time position along path curve
 
-    const VectorApproxFunction& getPath() const; //func(s) = [m, m, m]
+    const VectorApproxFunction& getPath() const; //func(s) = [m, m, m], throws logic_error if hasTrajectory()
+
+    bool hasTrajectory() const;
+    const Trajectory& getTrajectory() const; //throws logic_error if not hasTrajectory()
 
     double getRCS() const; //m2
 
@@ -0,0 +1,59 @@
+/*
+A Trajectory is a piecewise linear target path through positions at irregular times, such as a
+recorded AIS or radar track. Unlike VectorApproxFunction, the times need not be equally spaced,
+so a track is stored at its own timestamps instead of being resampled to a fine uniform grid.
+
+Trajectory track(times, positions, 5.0);
+Target target(move(track), rcs);
+
+With a tolerance > 0, the points are simplified on construction: points are dropped as long as
+the path through the remaining points is within tolerance of every input position at its own
+timestamp (Douglas-Peucker on the synchronized distance), so both the route and the speed along
+it are kept. Straight legs at constant speed shrink to their end points.
+
+Before the first time the position is the first position, after the last time the last position.
+A lookup can be given a cursor, the segment of the previous lookup by the same caller, and then
+searches forward from it with steps of increasing length. Evaluation at increasing simulation
+times, as pulse by pulse, is then amortized O(1). The Trajectory itself holds no lookup state, so
+it can be shared and evaluated from several threads, each with its own cursor. Every Target keeps
+a cursor of its own.
+*/
+
+#ifndef RADAR_TRAJECTORY_HPP
+#define RADAR_TRAJECTORY_HPP
+
+#include <vector>
+
+#include <radsim/mathematics/math_vector.hpp>
+
+namespace radsim {
+
+class Trajectory {
+  private:
+    std::vector<double> time; //s, increasing
+    std::vector<math_vector> position; //m
+
+    void simplify(double tolerance);
+    size_t findSegment(double t, size_t hint) const;
+
+  public:
+    Trajectory(std::vector<double> time_arg, std::vector<math_vector> position_arg, double tolerance = 0);
+    //time_arg: s, strictly increasing
+    //position_arg: m, one per time
+    //tolerance: m, max distance of the simplified path from the input positions, 0 keeps all points
+
+    math_vector output(double t) const; //m
+    //t: s
+
+    math_vector output(double t, size_t& cursor) const; //m
+    //t: s
+    //cursor: segment [time[cursor], time[cursor + 1]> of the previous lookup, updated to that of t. Start at 0.
+
+    size_t getNumPoints() const;
+    const std::vector<double>& getTimeVector() const; //s
+    const std::vector<math_vector>& getPositionVector() const; //m
+};
+
+}
+
+#endif
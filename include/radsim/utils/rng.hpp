@@ -1,4 +1,5 @@
 #include <memory>
+#include <cstdint>
 
 #ifndef UTILS_RNG_HPP
 #define UTILS_RNG_HPP
@@ -8,23 +9,39 @@ namespace radsim {
 /*
 Random number generator, using the c-lib stdlib.h function rand_r.
 The seed is kept track of by the object.
+
+rand_r has a 32 bit state, so it repeats after at most 2^32 numbers. For longer or many
+independent streams, the generator can instead use a 64 bit state and randomizing function, 
+e.g. RNG::splitmix64.
 */
 class RNG {
 
   unsigned int seed;
   double (*Q)(unsigned int *);  //[0, 1>: The randomizing function, taking 'seed' as input. 
+  uint64_t wide_seed;
+  double (*Q_wide)(uint64_t *); //[0, 1>: The randomizing function, taking 'wide_seed' as input. NULL if Q is used.
 
   void set_default_seed();
   void set_default_Q();
 
   public:
+    static constexpr uint64_t splitmix64_increment = 0x9e3779b97f4a7c15ULL; //state step per output
+
     RNG(bool custom = false, int seed_value = 0, double (*Q_custom)(unsigned int *) = NULL);
     //Q_custom: the custom randomizing function. 
     //if Q_custom==NULL, Q = rand_r. 
 
+    RNG(uint64_t seed_value, double (*Q_wide_custom)(uint64_t *));
+    //Q_wide_custom: randomizing function with a 64 bit state, e.g. &RNG::splitmix64
+
+    void setSeed(uint64_t seed_value); 
+    //keeps the randomizing function, a 32 bit function is seeded with the two halves xor'ed
+
     double output();
     unsigned int getSeed();
 
+    static double splitmix64(uint64_t * seed); //[0, 1>, period 2^64
+
 };
 
 }
@@ -0,0 +1,64 @@
+/*
+A fixed set of worker threads for data parallel loops.
+
+ThreadPool pool(4);
+pool.parallelFor(0, N, [&](size_t n) { ... });
+
+parallelFor blocks until func has been called for every index in [begin, end>. The calling 
+thread takes part in the work, so a pool of zero workers runs the loop serially. 
+The indices are handed out in chunks from a shared counter, so a thread that finishes early
+takes on the remaining work. By default there are a few chunks per thread. Loops with uneven
+work per index should use a small chunk_size, down to one index at a time. func must not throw.
+*/
+
+#ifndef UTILS_THREAD_POOL_HPP
+#define UTILS_THREAD_POOL_HPP
+
+#include <vector>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <functional>
+#include <atomic>
+
+namespace radsim {
+
+class ThreadPool {
+
+  std::vector<std::thread> workers;
+  std::mutex mtx;
+  std::condition_variable cv_start;
+  std::condition_variable cv_done;
+
+  //current loop, guarded by mtx
+  const std::function<void(size_t)> * job;
+  size_t job_end;
+  size_t chunk;
+  unsigned long generation; //incremented for every loop
+  int    num_busy;          //workers still working on the current loop
+  bool   stopping;
+
+  std::atomic<size_t> next_index;
+
+  void workerLoop();
+  void runChunks(const std::function<void(size_t)>& func, size_t end, size_t chunk_size);
+
+  public:
+    ThreadPool(int num_threads = -1);
+    //num_threads: number of worker threads, in addition to the calling thread. 
+    //             Negative gives hardware_concurrency - 1.
+
+    ThreadPool(const ThreadPool& other) = delete;
+    ThreadPool& operator=(const ThreadPool& other) = delete;
+
+    ~ThreadPool();
+
+    int getNumThreads() const; //workers + calling thread
+
+    void parallelFor(size_t begin, size_t end, const std::function<void(size_t)>& func, size_t chunk_size = 0);
+    //chunk_size: indices handed out at a time, 0 gives the default
+};
+
+}
+
+#endif
@@ -8,11 +8,18 @@ namespace radsim {
 
 class Timer {
 
-  std::chrono::high_resolution_clock::time_point t_start;
+  std::chrono::steady_clock::time_point t_start;
 
   public:
+    static constexpr double default_slack = 0.0005; //s
+
     Timer();
     double elapsed(); //s, time since initiation of object. 
+
+    void sleepUntil(double t, double slack = default_slack);
+    //t: s, since initiation of object. Sleeps until slack before t, then busy-waits the rest,
+    //so that the wake-up latency of the sleep does not delay the return.
+    //slack: s
    
 };
 
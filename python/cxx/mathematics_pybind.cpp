@@ -1,6 +1,8 @@
 #include <vector>
 #include <array>
 #include <complex>
+#include <span>
+#include <algorithm>
 
 #include <Python.h>
 #include <pybind11/pybind11.h>
@@ -12,6 +14,7 @@
 #include <radsim/mathematics/approx_function.hpp>
 #include <radsim/mathematics/math_vector.hpp>
 #include <radsim/mathematics/fourier.hpp>
+#include <radsim/mathematics/fft.hpp>
 
 
 using namespace std;
@@ -23,10 +26,18 @@ namespace py = pybind11;
 namespace {
 
 //Approx Functions
+//Evaluated directly into the returned array, sorted input (e.g. np.linspace) takes the cursor path
 template <class T>
-py::array_t<T> ApproxFunctionType_Py_Call(const ApproxFunction<T>& F, py::array_t<double> py_input) {
-  vector<double> input = py_convert::vector(py_input);
-  return py_convert::numpy_array( F.outputVector(input) );
+py::array_t<T> ApproxFunctionType_Py_Call(const ApproxFunction<T>& F, py::array_t<double, py::array::c_style | py::array::forcecast> py_input) {
+  size_t size = py_input.size();
+  py::array_t<T> py_output(size);
+  span<const double> input(py_input.data(), size);
+  span<T> output(py_output.mutable_data(), size);
+  if (is_sorted(input.begin(), input.end()))
+    F.outputSortedInto(input, output);
+  else
+    F.outputInto(input, output);
+  return py_output;
 }
 
 template <class T>
@@ -61,6 +72,38 @@ PYBIND11_MODULE(mathematics_python, m) {
      return fourierTransform(G, move(f_entry), dt, begin, end, inv);
    } );
 
+  m.def("non_uniform_fourier_transform", [](const ComplexApproxFunction& G, py::array_t<double> py_f, double dt, double begin, double end, bool inv) 
+  -> py::array_t<complex<double>> {
+     vector<double> f = py_convert::vector(py_f);
+     vector<complex<double>> F;
+     {
+       py::gil_scoped_release release;
+       F = nonUniformFourierTransform(G, f, dt, begin, end, inv);
+     }
+     return py_convert::numpy_array(F);
+   }, py::arg("G"), py::arg("f"), py::arg("dt"), py::arg("begin"), py::arg("end"), py::arg("inverse") = false );
+
+
+  m.def("fast_fourier_transform", [](const ComplexApproxFunction& G, size_t N, double dt, double begin, bool inv) -> ComplexApproxFunction {
+     return fastFourierTransform(G, N, dt, begin, inv);
+   }, py::arg("G"), py::arg("N"), py::arg("dt"), py::arg("begin"), py::arg("inverse") = false );
+
+  m.def("fast_fourier_transform", [](const DoubleApproxFunction& G, size_t N, double dt, double begin, bool inv) -> ComplexApproxFunction {
+     return fastFourierTransform(G, N, dt, begin, inv);
+   }, py::arg("G"), py::arg("N"), py::arg("dt"), py::arg("begin"), py::arg("inverse") = false );
+
+
+  //FFT of sampled data
+  m.def("fft", [](py::array_t<complex<double>> py_data, bool inv) -> py::array_t<complex<double>> {
+     vector<complex<double>> data = py_convert::vector(py_data);
+     fft(data, inv);
+     return py_convert::numpy_array(data);
+   }, py::arg("data"), py::arg("inverse") = false );
+
+  m.def("rfft", [](py::array_t<double> py_data) -> py::array_t<complex<double>> {
+     vector<double> data = py_convert::vector(py_data);
+     return py_convert::numpy_array( rfft(data) );
+   } );
 
   //DoubleApproxFunction
   py::class_<DoubleApproxFunction> (m, "DoubleApproxFunction")
@@ -20,6 +20,7 @@
 #include <radsim/radar/radar_config_parser.hpp>
 #include <radsim/radar/pulse_data.hpp>
 #include <radsim/radar/radar.hpp>
+#include <radsim/radar/parameter_sweep.hpp>
 
 using namespace std;
 using namespace std::complex_literals;
@@ -82,6 +83,28 @@ namespace {
       }
   };
 
+
+  template <class T>
+  void bindPulseData(py::module& m, const char * name) {
+    py::class_<BasicPulseData<T>> (m, name)
+
+    .def("get_copy_registry", [](BasicPulseData<T>& data) -> py::array_t<T> { 
+      return py_convert::numpy_array( data.registry );
+     } )
+
+    .def_property_readonly("boresight", [](BasicPulseData<T>& data) -> py::array_t<double> { 
+        return py_convert::numpy_array( data.getBoresight() );
+      } )
+
+    .def("__len__", [](BasicPulseData<T>& data) -> int { 
+        return data.registry.size();
+      } )
+
+    .def("has_original", &BasicPulseData<T>::hasOriginalRegistry)
+    .def_property_readonly("time", &BasicPulseData<T>::getStartTime)
+    ;
+  }
+
 }
 
 
@@ -106,8 +129,31 @@ PYBIND11_MODULE(radar_python, m) {
   m.def("create_beam_pattern", &createBeamPattern);
   
 
+  // ************************ Trajectory ******************************************** 
+  py::class_<Trajectory> (m, "Trajectory")
+  .def(py::init([](py::array_t<double> py_time, py::array py_position, double tolerance) {
+     vector<double> time = py_convert::vector(py_time);
+     vector<math_vector> position = py_convert::matrix(py_position);
+     return Trajectory( move(time), move(position), tolerance );
+   }  ), py::arg("time"), py::arg("position"), py::arg("tolerance") = 0 )
+  .def("__call__", [](const Trajectory& trajectory, double t) -> py::array_t<double> {
+     return py_convert::numpy_array( trajectory.output(t) );
+   } )
+  .def_property_readonly("num_points", &Trajectory::getNumPoints)
+  .def_property_readonly("time", [](const Trajectory& trajectory) -> py::array_t<double> {
+     return py_convert::numpy_array( trajectory.getTimeVector() );
+   } )
+  .def_property_readonly("position", [](const Trajectory& trajectory) -> py::array {
+     return py_convert::numpy_matrix( trajectory.getPositionVector() );
+   } )
+  ;
+
+
   // ************************ Target ************************************************ 
   py::class_<Target> (m, "Target")
+  .def(py::init([](const Trajectory& trajectory, double rcs) {
+     return Target(trajectory, rcs);
+   }  )  )
   .def(py::init([](VectorApproxFunction path, double rcs) {
      return Target( move(path), rcs);
    }  )  )
@@ -118,6 +164,7 @@ PYBIND11_MODULE(radar_python, m) {
   
   .def("get_position", &TargetGetPosition, py::arg("t") = 0)
   .def_property_readonly("rcs", &Target::getRCS)
+  .def_property_readonly("has_trajectory", &Target::hasTrajectory)
 
   .def("get_path", [](const Target& target) -> VectorApproxFunction { 
     VectorApproxFunction path = target.getPath();
@@ -155,8 +202,24 @@ PYBIND11_MODULE(radar_python, m) {
      } ), py::arg("numLevels"), py::arg("mode"), py::arg("maximumPower"),  py::arg("minimumPower") = 0  )
 
    .def_property_readonly("num_levels", &ADC::getNumLevels)
-   .def("convert", &ADC::convertSignal);
+   .def("convert", &ADC::convertSignal)
+   .def("convert_amplitude", &ADC::convertAmplitude);
+
+
+
+  //*************************** Waveform *************************
+  py::enum_<Waveform>(m, "Waveform")
+     .value("Rectangular", Waveform::Rectangular)
+     .value("LFM", Waveform::LFM)
+  .export_values();
+
 
+  //*************************** ClutterType *************************
+  py::enum_<ClutterType>(m, "ClutterType")
+     .value("NoClutter", ClutterType::None)
+     .value("Sea", ClutterType::Sea)
+     .value("Land", ClutterType::Land)
+  ;
 
 
   //*************************** RadarConfig *************************
@@ -182,6 +245,11 @@ PYBIND11_MODULE(radar_python, m) {
   .def_property("adc_mode", &RadarConfig::getADCMode, &RadarConfig::setADCMode)
   .def_property("adc_min_2_noise", &RadarConfig::getADCMin2Noise, &RadarConfig::setADCMin2Noise)
   .def_property("adc_max_2_noise", &RadarConfig::getADCMax2Noise, &RadarConfig::setADCMax2Noise)
+  .def_property("waveform", &RadarConfig::getWaveform, &RadarConfig::setWaveform)
+  .def_property("chirp_bandwidth", &RadarConfig::getChirpBandWidth, &RadarConfig::setChirpBandWidth)
+  .def_property("clutter_type", &RadarConfig::getClutterType, &RadarConfig::setClutterType)
+  .def_property("clutter_sigma0", &RadarConfig::getClutterSigma0, &RadarConfig::setClutterSigma0)
+  .def_property("clutter_shape", &RadarConfig::getClutterShape, &RadarConfig::setClutterShape)
   ;
 
 
@@ -190,27 +258,14 @@ PYBIND11_MODULE(radar_python, m) {
   .def(py::init<>())
   .def("parse_file", &RadarConfigParser::parseFile)
   .def("parse_string", &RadarConfigParser::parseString)
+  .def("set_keyword", &RadarConfigParser::setKeyword)
   ;
 
 
   // *********************** PulseData ********************
-  py::class_<PulseData> (m, "PulseData")
-
-  .def("get_copy_registry", [](PulseData& data) -> py::array_t<unsigned short> { 
-    return py_convert::numpy_array( data.registry );
-   } )
-
-  .def_property_readonly("boresight", [](PulseData& data) -> py::array_t<double> { 
-      return py_convert::numpy_array( data.getBoresight() );
-    } )
-
-  .def("__len__", [](PulseData& data) -> int { 
-      return data.registry.size();
-    } )
-
-  .def("has_original", &PulseData::hasOriginalRegistry)
-  .def_property_readonly("time", &PulseData::getStartTime)
-  ;
+  bindPulseData<unsigned short>(m, "PulseData");
+  bindPulseData<unsigned char>(m, "BytePulseData");
+  bindPulseData<short>(m, "IQPulseData");
 
 
   // ************************* Radar *****************************
@@ -225,6 +280,26 @@ PYBIND11_MODULE(radar_python, m) {
       return radar.generatePulseData(collection.getList(), signal_override, signal_strength);
     }, py::arg("collection"), py::arg("signal_override") = false, py::arg("signal_strength") = 0 )
 
+  .def("generate_byte_pulse_data", [](Radar& radar) -> BytePulseData { 
+      return radar.generatePulseData<unsigned char>();
+    } )
+
+  .def("generate_byte_pulse_data", [](Radar& radar, const PythonTargetCollection& collection, bool signal_override, double signal_strength) -> BytePulseData { 
+      return radar.generatePulseData<unsigned char>(collection.getList(), signal_override, signal_strength);
+    }, py::arg("collection"), py::arg("signal_override") = false, py::arg("signal_strength") = 0 )
+
+  .def("generate_iq_pulse_data", [](Radar& radar) -> IQPulseData { 
+      return radar.generateIQPulseData();
+    } )
+
+  .def("generate_iq_pulse_data", [](Radar& radar, const PythonTargetCollection& collection, bool signal_override, double signal_strength) -> IQPulseData {
+      return radar.generateIQPulseData(collection.getList(), signal_override, signal_strength);
+    }, py::arg("collection"), py::arg("signal_override") = false, py::arg("signal_strength") = 0 )
+
+  .def("set_static_targets", [](Radar& radar, const PythonTargetCollection& collection) {
+      radar.setStaticTargets(collection.getList());
+    })
+  .def("clear_static_targets", &Radar::clearStaticTargets)
   .def("reset", [](Radar& radar, double t) { 
       radar.reset(t);
     }, py::arg("t") = 0 )
@@ -242,6 +317,11 @@ PYBIND11_MODULE(radar_python, m) {
   .def_property_readonly("peak_power", &Radar::getPeakPower)
   .def_property_readonly("pulse_width", &Radar::getPulseWidth)
   .def_property_readonly("prt", &Radar::getPRT)
+  .def_property_readonly("carrier_wavelength", &Radar::getCarrierWavelength)
+  .def_property_readonly("num_range_bins", &Radar::getNumRangeBins)
+  .def_property_readonly("num_static_targets", &Radar::getNumStaticTargets)
+  .def_property_readonly("waveform", &Radar::getWaveform)
+  .def_property_readonly("chirp_bandwidth", &Radar::getChirpBandWidth)
   .def_property_readonly("sampling_time", &Radar::getSamplingTime, "s, time betweeen samplings, current model uses a fixed formulae")
   .def_property_readonly("duplexer_switch_time", &Radar::getDuplexerSwitchTime)
   .def_property_readonly("max_receive_time", &Radar::getMaximumReiceiveTime)
@@ -254,13 +334,70 @@ PYBIND11_MODULE(radar_python, m) {
   .def_property_readonly("current_time", &Radar::getCurrentTime)
 
   .def_property("add_noise", &Radar::getToAddNoise, &Radar::setToAddNoise)
+  .def_property("add_clutter", &Radar::getToAddClutter, &Radar::setToAddClutter)
   .def_property("add_target", &Radar::getToAddTarget, &Radar::setToAddTarget)
   .def_property("use_pdf", &Radar::getUsePdf, &Radar::setUsePdf)
   .def_property("use_filtered_pulse", &Radar::getToUseFilteredPulse, &Radar::setToUseFilteredPulse)
+  .def_property("add_doppler", &Radar::getToAddDoppler, &Radar::setToAddDoppler)
   .def_property("ant_rot_speed", &Radar::getAntRotSpeed, &Radar::setAntRotSpeed)
   .def_property("initial_hor_theta", &Radar::getInitialHorTheta, &Radar::setInitialHorTheta)
 
   .def("get_current_theta", &Radar::getCurrentHorTheta)
   ;
 
+
+
+  // ************************* ParameterSweep *****************************
+  py::class_<SweepTable> (m, "SweepTable")
+  .def("get_column", [](const SweepTable& table, const string& name) -> py::array_t<double> {
+      return py_convert::numpy_array( table.getColumn(name) );
+    })
+  .def("get_column", [](const SweepTable& table, size_t index) -> py::array_t<double> {
+      return py_convert::numpy_array( table.getColumn(index) );
+    })
+  .def_property_readonly("column_names", [](const SweepTable& table) -> py::list {
+      py::list names;
+      for (const string& name : table.getColumnNames())
+        names.append(name);
+      return names;
+    })
+  .def_property_readonly("num_rows", &SweepTable::getNumRows)
+  .def_property_readonly("num_columns", &SweepTable::getNumColumns)
+  .def("__len__", &SweepTable::getNumRows)
+  ;
+
+  py::class_<ParameterSweep> (m, "ParameterSweep")
+  .def(py::init<const RadarConfig&, int>(), py::arg("config"), py::arg("num_threads") = -1)
+  .def("add_axis", [](ParameterSweep& sweep, const string& keyword, py::array_t<double> values) {
+      sweep.addAxis(keyword, py_convert::vector(values));
+    })
+  .def("get_config", &ParameterSweep::getConfig)
+  .def("get_point_values", [](const ParameterSweep& sweep, size_t point) -> py::array_t<double> {
+      return py_convert::numpy_array( sweep.getPointValues(point) );
+    })
+  .def_property_readonly("num_axes", &ParameterSweep::getNumAxes)
+  .def_property_readonly("num_points", &ParameterSweep::getNumPoints)
+  .def_property_readonly("num_threads", &ParameterSweep::getNumThreads)
+
+  //metric(radar, point) returns a sequence of one value per metric name. The radars are built
+  //in parallel, the Python metric itself runs under the GIL.
+  .def("run", [](ParameterSweep& sweep, py::function metric, py::list names) -> SweepTable {
+      vector<string> metric_names;
+      for (auto name : names)
+        metric_names.push_back( name.cast<string>() );
+
+      auto func = [&](Radar& radar, size_t point) -> vector<double> {
+        py::gil_scoped_acquire acquire;
+        py::object result = metric(py::cast(&radar, py::return_value_policy::reference), point);
+        vector<double> values;
+        for (auto value : result)
+          values.push_back( value.cast<double>() );
+        return values;
+      };
+
+      py::gil_scoped_release release;
+      return sweep.run(func, metric_names);
+    })
+  ;
+
 }
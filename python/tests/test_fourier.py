@@ -3,8 +3,8 @@ import unittest
 
 import bkradsim.utils as Utils
 
-from bkradsim.mathematics import ComplexApproxFunction
-from bkradsim.mathematics import Fourier
+from bkradsim.mathematics import ComplexApproxFunction, DoubleApproxFunction
+from bkradsim.mathematics import Fourier, fft, rfft, fast_fourier_transform, non_uniform_fourier_transform
 
 def Gauss(t):
     return np.exp(-t * t)
@@ -37,5 +37,27 @@ class FourierTester(unittest.TestCase):
     def test_tablefunction(self):
         pass
 
+    #mixed radix and real transforms agree with numpy
+    def test_fft(self):
+        x = np.cos(0.3 * np.arange(30)) + 1.0j * np.sin(1.7 * np.arange(30))
+        self.assertTrue( np.allclose( fft(x), np.fft.fft(x) ) )
+        self.assertTrue( np.allclose( fft(fft(x), True), x ) )
+        self.assertTrue( np.allclose( rfft(x.real), np.fft.rfft(x.real) ) )
+
+    #irregular frequencies, as the transform of single frequencies
+    def test_non_uniform_transform(self):
+        t = np.arange(-3.0, 3.0, 0.02)
+        G = ComplexApproxFunction(t, Gauss(t).astype(complex))
+        f = np.array([-0.7, 0.0, 0.1, 0.45])
+        F = non_uniform_fourier_transform(G, f, 4e-3, -3.0, 2.9)
+        for k in range(len(f)):
+            self.assertTrue( Utils.complex_equal( F[k], np.sqrt(np.pi) * np.exp(-np.pi**2 * f[k]**2), 1e-2 ) )
+
+    def test_fast_transform(self):
+        t = np.arange(-3.0, 3.0, 0.02)
+        G = DoubleApproxFunction(t, Gauss(t))
+        F = fast_fourier_transform(G, len(t), 0.02, -3.0)
+        self.assertTrue(Utils.complex_equal( F(0.0), np.sqrt(np.pi), 2e-3  ))
+
 if __name__ == '__main__':
     unittest.main()
@@ -0,0 +1,40 @@
+import sys, os
+
+import unittest
+import numpy as np
+
+from bkradsim.radar import RadarConfigParser, ParameterSweep
+
+
+class ParameterSweepTester(unittest.TestCase):
+
+    @classmethod
+    def setUpClass(cls):
+       setup_file = "../python_setup.conf"
+       with open(setup_file, "r") as f:
+         cls.config_file = os.path.join(f.readline().rstrip('\r\n'), "radar_configs/short_range_radar.txt")
+
+    def test_sweep(self):
+        config = RadarConfigParser().parse_file(self.config_file)
+        sweep = ParameterSweep(config, 1)
+        sweep.add_axis("PulseWidth", np.array([0.25, 0.5]))
+        sweep.add_axis("NoiseFigure", np.array([2.0, 4.0, 6.0]))
+        self.assertEqual(sweep.num_points, 6)
+
+        table = sweep.run(lambda radar, point: [radar.pulse_width, radar.avg_noise], ["pw", "noise"])
+        self.assertEqual(table.column_names, ["PulseWidth", "NoiseFigure", "pw", "noise"])
+        self.assertEqual(len(table), 6)
+        np.testing.assert_allclose(table.get_column("PulseWidth"), table.get_column("pw") * 1e6)
+        noise = table.get_column("noise")
+        assert( noise[0] < noise[1] < noise[2] )
+
+    def test_set_keyword(self):
+        config = RadarConfigParser().parse_file(self.config_file)
+        RadarConfigParser().set_keyword(config, "PulseWidth", 0.5)
+        self.assertAlmostEqual(config.pulse_width, 0.5e-6)
+        with self.assertRaises(Exception):
+            RadarConfigParser().set_keyword(config, "ADCResolution", 8.5)
+
+
+if __name__ == '__main__':
+    unittest.main()
@@ -4,7 +4,7 @@ import unittest
 import numpy as np
 
 import bkradsim.utils as Utils
-from bkradsim.radar import RadarConfig, RadarConfigParser, ADCMode
+from bkradsim.radar import RadarConfig, RadarConfigParser, ADCMode, Waveform, ClutterType
 
 deg_to_rad = np.pi / 180.0
 
@@ -72,6 +72,10 @@ ADCMin2Noise     0.01953125 #unit
         config.adc_mode       = ADCMode.Power
         config.adc_min_2_noise = 0.25
         config.adc_max_2_noise = 0.50
+        config.waveform = Waveform.LFM
+        config.chirp_bandwidth = 2.0 #Mhz
+        config.clutter_type = ClutterType.Sea
+        config.clutter_shape = 0.5
 
         self.assertAlmostEqual(config.frequency, 1.0e9, places=4)
         self.assertAlmostEqual(config.peak_power, 10000.0, places=4)
@@ -90,6 +94,11 @@ ADCMin2Noise     0.01953125 #unit
         assert( config.adc_mode == ADCMode.Power )
         assert( config.adc_min_2_noise == 0.25 )
         assert( config.adc_max_2_noise == 0.50 )
+        assert( config.waveform == Waveform.LFM )
+        self.assertAlmostEqual(config.chirp_bandwidth, 2.0e6, places=4)
+        assert( config.clutter_type == ClutterType.Sea )
+        self.assertAlmostEqual(config.clutter_sigma0, 1e-4, places=6)
+        self.assertAlmostEqual(config.clutter_shape, 0.5, places=6)
 
 
 if __name__ == '__main__':
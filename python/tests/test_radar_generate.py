@@ -93,6 +93,48 @@ class TestPulseData(unittest.TestCase):
      assert( reg[2] == reg[222] )
 
 
+  def test_generate_byte(self):
+
+     #the short range radar has a 10-bit ADC
+     self.radar.reset()
+     with self.assertRaises(RuntimeError):
+        self.radar.generate_byte_pulse_data()
+
+     config = RadarConfigParser().parse_string("""
+Frequency        10.0
+PeakPower        10000
+PulseWidth       0.25
+SamplingTime     0.25
+PRT              0.13333333333
+BandWidth        4.0
+NoiseFigure      4.0
+DuplexSwitchTime 3.08333333
+AntennaeGain     30.0
+AzBeamWidth      2.0
+ElBeamWidth      40.0
+ADCResolution    8
+ADCMode          Power
+ADCMin2Noise     0.01953125
+""")
+     radar = Radar(config)
+     data = radar.generate_byte_pulse_data(self.collection, True, 1e-5)
+     reg = data.get_copy_registry()
+     assert( type(reg[0]) == np.uint8 )
+     assert( reg[190] == 255 )
+
+
+  def test_generate_iq(self):
+
+     self.radar.reset()
+     self.radar.add_noise = False
+     data = self.radar.generate_iq_pulse_data(self.collection, True, 1e-5)
+     reg = data.get_copy_registry()
+     assert( type(reg[0]) == np.int16 )
+     assert( len(data) == 2 * self.radar.num_range_bins )
+     assert( reg[0] == 0 and reg[1] == 0 )
+     self.radar.add_noise = True
+
+
 if __name__ == '__main__':
     unittest.main()
 
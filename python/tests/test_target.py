@@ -3,7 +3,7 @@
 import unittest
 import numpy as np
 
-from bkradsim.radar import Target, TargetCollection
+from bkradsim.radar import Target, TargetCollection, Trajectory
 from bkradsim.mathematics import MathVectorApproxFunction
 
 class TestTargetType(unittest.TestCase):
@@ -27,6 +27,21 @@ class TestTargetType(unittest.TestCase):
         path_copy = T.get_path()
         assert( len(path_copy.entry) == 2 )
 
+    def test_trajectory(self):
+        time = np.array([0.0, 0.5, 1.7, 2.0])
+        position = np.array([[0.0, 0.0, 0.0], [5.0, 0.0, 0.0], [17.0, 0.0, 0.0], [17.0, 3.0, 0.0]])
+        track = Trajectory(time, position)
+        assert( track.num_points == 4 )
+        assert( np.allclose(track(1.0), np.array([10.0, 0.0, 0.0])) )
+
+        simplified = Trajectory(time, position, 0.1)
+        assert( simplified.num_points == 3 )
+        assert( np.array_equal(simplified.time, np.array([0.0, 1.7, 2.0])) )
+
+        T = Target(track, 2.0)
+        assert( T.has_trajectory )
+        assert( np.allclose(T.get_position(1.85), np.array([17.0, 1.5, 0.0])) )
+
     def test_collection(self):
         pos1 = np.array([1.0, 2.0, 4.0])
         T1 = Target(pos1, 2.0)
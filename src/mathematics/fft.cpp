@@ -0,0 +1,277 @@
+#include <math.h>
+
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <map>
+#include <mutex>
+
+#include <radsim/mathematics/constants.hpp>
+#include <radsim/mathematics/fft.hpp>
+
+using namespace std;
+
+namespace radsim {
+
+bool isPowerOfTwo(size_t N) {
+  return N > 0 && (N & (N - 1)) == 0;
+}
+
+size_t nextPowerOfTwo(size_t N) {
+  size_t P = 1;
+  while (P < N)
+    P <<= 1;
+  return P;
+}
+
+
+FFTPlan::FFTPlan(size_t N_arg) :
+  N( N_arg )
+{
+  if (N == 0)
+    throw invalid_argument(__PRETTY_FUNCTION__ + string(": number of samples must be positive."));
+
+  if (isPowerOfTwo(N)) {
+    bit_reversal.resize(N);
+    twiddle.resize(N / 2);
+    inverse_twiddle.resize(N / 2);
+
+    bit_reversal[0] = 0;
+    for (size_t i = 1, j = 0; i < N; i++) {
+      size_t bit = N >> 1;
+      for (; j & bit; bit >>= 1)
+        j ^= bit;
+      j ^= bit;
+      bit_reversal[i] = j;
+    }
+
+    for (size_t k = 0; k < N / 2; k++) {
+      twiddle[k] = polar(1.0, -2 * pi * k / N);
+      inverse_twiddle[k] = conj(twiddle[k]);
+    }
+    return;
+  }
+
+  //prime factors, smallest first
+  vector<size_t> radices;
+  size_t rest = N;
+  for (size_t p = 2; p * p <= rest; p++)
+    while (rest % p == 0) {
+      radices.push_back(p);
+      rest /= p;
+    }
+  if (rest > 1)
+    radices.push_back(rest);
+
+  size_t span = 1;
+  for (size_t radix : radices) {
+    stages.push_back( {radix, span, stage_twiddle.size(), roots.size()} );
+    for (size_t k = 0; k < span; k++)
+      for (size_t r = 1; r < radix; r++)
+        stage_twiddle.push_back( polar(1.0, -2 * pi * r * k / (span * radix)) );
+    for (size_t r = 0; r < radix; r++)
+      roots.push_back( polar(1.0, -2 * pi * r / radix) );
+    span *= radix;
+  }
+}
+
+
+namespace {
+  mutex plans_mutex;
+  map<size_t, shared_ptr<const FFTPlan>> plans; //guarded by plans_mutex
+  map<size_t, shared_ptr<const RealFFTPlan>> real_plans; //guarded by plans_mutex
+}
+
+
+shared_ptr<const FFTPlan> FFTPlan::get(size_t N_arg) {
+  lock_guard<mutex> lock(plans_mutex);
+  auto& plan = plans[N_arg];
+  if (!plan)
+    plan = make_shared<const FFTPlan>(N_arg);
+  return plan;
+}
+
+
+size_t FFTPlan::size() const {
+  return N;
+}
+
+
+void FFTPlan::execute(complex<double> * data, bool inverse) const {
+  if (stages.empty()) {
+    executeRadix2(data, inverse);
+    return;
+  }
+
+  //the inverse is the conjugate of the forward transform of the conjugate
+  if (inverse)
+    for (size_t n = 0; n < N; n++)
+      data[n] = conj(data[n]);
+
+  executeMixedRadix(data);
+
+  if (inverse) {
+    double scale = 1.0 / N;
+    for (size_t n = 0; n < N; n++)
+      data[n] = conj(data[n]) * scale;
+  }
+}
+
+
+//iterative radix-2 Cooley-Tukey
+void FFTPlan::executeRadix2(complex<double> * data, bool inverse) const {
+  for (size_t i = 1; i < N; i++) {
+    size_t j = bit_reversal[i];
+    if (i < j)
+      swap(data[i], data[j]);
+  }
+
+  //butterflies on the interleaved real and imaginary parts
+  double * x = reinterpret_cast<double *>(data);
+  const double * w = reinterpret_cast<const double *>(inverse ? inverse_twiddle.data() : twiddle.data());
+  for (size_t len = 2; len <= N; len <<= 1) {
+    size_t half = len / 2;
+    size_t stride = N / len; //twiddle index step
+    for (size_t start = 0; start < N; start += len) {
+      double * a = x + 2 * start;
+      double * b = a + 2 * half;
+      for (size_t k = 0; k < half; k++) {
+        double w_re = w[2 * k * stride];
+        double w_im = w[2 * k * stride + 1];
+        double odd_re = b[2 * k] * w_re - b[2 * k + 1] * w_im;
+        double odd_im = b[2 * k] * w_im + b[2 * k + 1] * w_re;
+        b[2 * k]     = a[2 * k] - odd_re;
+        b[2 * k + 1] = a[2 * k + 1] - odd_im;
+        a[2 * k]     += odd_re;
+        a[2 * k + 1] += odd_im;
+      }
+    }
+  }
+
+  if (inverse) {
+    double scale = 1.0 / N;
+    for (size_t n = 0; n < 2 * N; n++)
+      x[n] *= scale;
+  }
+}
+
+
+//Stockham autosort, one pass per prime factor. Pass s combines N / (span * radix) groups of radix 
+//transforms of size span into transforms of size span * radix, reading with stride N / radix. 
+void FFTPlan::executeMixedRadix(complex<double> * data) const {
+  vector<complex<double>> work(N);
+  complex<double> * src = data;
+  complex<double> * dst = work.data();
+
+  size_t max_radix = 0;
+  for (const Stage& stage : stages)
+    max_radix = max(max_radix, stage.radix);
+  vector<complex<double>> v(max_radix);
+
+  for (const Stage& stage : stages) {
+    size_t radix = stage.radix;
+    size_t span = stage.span;
+    size_t stride = N / radix;
+    const complex<double> * w = stage_twiddle.data() + stage.twiddle_offset;
+    const complex<double> * root = roots.data() + stage.root_offset;
+
+    for (size_t j = 0; j < stride; j++) {
+      size_t k = j % span;
+      v[0] = src[j];
+      for (size_t r = 1; r < radix; r++)
+        v[r] = src[j + r * stride] * w[k * (radix - 1) + r - 1];
+
+      complex<double> * out = dst + (j / span) * span * radix + k;
+      if (radix == 2) {
+        out[0]    = v[0] + v[1];
+        out[span] = v[0] - v[1];
+        continue;
+      }
+      for (size_t q = 0; q < radix; q++) {
+        complex<double> sum = v[0];
+        for (size_t r = 1, rq = q; r < radix; r++, rq = (rq + q) % radix)
+          sum += v[r] * root[rq];
+        out[q * span] = sum;
+      }
+    }
+    swap(src, dst);
+  }
+
+  if (src != data)
+    copy(src, src + N, data);
+}
+
+
+RealFFTPlan::RealFFTPlan(size_t N_arg) :
+  N( N_arg )
+{
+  if (N == 0 || N % 2 != 0)
+    throw invalid_argument(__PRETTY_FUNCTION__ + string(": number of real samples must be even."));
+
+  half_plan = FFTPlan::get(N / 2);
+  twiddle.resize(N / 2 + 1);
+  for (size_t k = 0; k <= N / 2; k++)
+    twiddle[k] = polar(1.0, -2 * pi * k / N);
+}
+
+
+shared_ptr<const RealFFTPlan> RealFFTPlan::get(size_t N_arg) {
+  {
+    lock_guard<mutex> lock(plans_mutex);
+    auto it = real_plans.find(N_arg);
+    if (it != real_plans.end())
+      return it->second;
+  }
+  auto plan = make_shared<const RealFFTPlan>(N_arg); //outside the lock, FFTPlan::get locks
+
+  lock_guard<mutex> lock(plans_mutex);
+  return real_plans.emplace(N_arg, plan).first->second;
+}
+
+
+size_t RealFFTPlan::size() const {
+  return N;
+}
+
+
+//The even and odd samples are packed as the real and imaginary parts of a transform of size N/2,
+//and separated with its conjugate symmetry. 
+void RealFFTPlan::execute(const double * input, complex<double> * output) const
+//output: N/2 + 1 bins
+{
+  size_t M = N / 2;
+  for (size_t n = 0; n < M; n++)
+    output[n] = complex<double>(input[2 * n], input[2 * n + 1]);
+  half_plan->execute(output);
+  output[M] = output[0];
+
+  for (size_t k = 0; k <= M / 2; k++) {
+    complex<double> Z_k = output[k];
+    complex<double> Z_mk = conj(output[M - k]);
+    complex<double> even = 0.5 * (Z_k + Z_mk);
+    complex<double> odd = complex<double>(0, -0.5) * (Z_k - Z_mk);
+    complex<double> even_m = conj(even); //bin M - k
+    complex<double> odd_m = conj(odd);
+    output[k] = even + twiddle[k] * odd;
+    output[M - k] = even_m + twiddle[M - k] * odd_m;
+  }
+}
+
+
+void fft(complex<double> * data, size_t N, bool inverse) {
+  FFTPlan::get(N)->execute(data, inverse);
+}
+
+
+void fft(vector<complex<double>>& data, bool inverse) {
+  fft(data.data(), data.size(), inverse);
+}
+
+
+vector<complex<double>> rfft(const vector<double>& data) {
+  vector<complex<double>> output(data.size() / 2 + 1);
+  RealFFTPlan::get(data.size())->execute(data.data(), output.data());
+  return output;
+}
+
+}
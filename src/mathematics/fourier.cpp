@@ -1,13 +1,77 @@
 #include <complex.h>
 #include <iostream>
 #include <memory>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
 
 #include <radsim/mathematics/constants.hpp>
+#include <radsim/mathematics/fft.hpp>
 #include <radsim/mathematics/fourier.hpp>
 
 using namespace std;
 using namespace std::complex_literals;
 
+namespace {
+
+  const size_t phasor_block = 64;   //samples between exact evaluations of the phasor
+  const size_t frequency_block = 8; //frequencies summed together, in independent lanes
+
+  //G at t_start, t_start + dt ... < t_end, the times accumulated as in a plain loop over t
+  template <class T>
+  void sampleFunction(const radsim::ApproxFunction<T>& G, double dt, double t_start, double t_end, 
+                      vector<T>& samples, vector<double>& times) {
+    for (double t = t_start; t < t_end; t += dt) {
+      times.push_back(t);
+      samples.push_back(G.output(t));
+    }
+  }
+
+  //F_j = sum_n samples[n] * exp(Sign * 2 * pi * i * times[n] * f[j]), j < count <= frequency_block, times spaced by dt.
+  //The phasors are advanced by exp(Sign * 2 * pi * i * dt * f) per sample, in arrays of real and 
+  //imaginary parts of fixed length so the lanes can be vectorized.
+  template <class T>
+  void transformBlock(const vector<T>& samples, const vector<double>& times, double dt,
+                      const double * f, complex<double> * F, size_t count, double Sign) {
+    double F_re[frequency_block] = {};
+    double F_im[frequency_block] = {};
+    double p_re[frequency_block], p_im[frequency_block]; //phasor at the current sample
+    double w_re[frequency_block], w_im[frequency_block]; //phasor step per sample
+    double omega[frequency_block];                       //rad/s
+
+    for (size_t j = 0; j < frequency_block; j++)
+      omega[j] = j < count ? Sign * 2 * pi * f[j] : 0;
+
+    size_t N = samples.size();
+    for (size_t first = 0; first < N; first += phasor_block) {
+      size_t last = min(first + phasor_block, N);
+      for (size_t j = 0; j < frequency_block; j++) {
+        p_re[j] = cos(omega[j] * times[first]);
+        p_im[j] = sin(omega[j] * times[first]);
+        w_re[j] = cos(omega[j] * dt);
+        w_im[j] = sin(omega[j] * dt);
+      }
+
+      for (size_t n = first; n < last; n++) {
+        double g_re = real(samples[n]);
+        double g_im = imag(samples[n]);
+        for (size_t j = 0; j < frequency_block; j++) {
+          F_re[j] += g_re * p_re[j] - g_im * p_im[j];
+          F_im[j] += g_re * p_im[j] + g_im * p_re[j];
+          double re = p_re[j] * w_re[j] - p_im[j] * w_im[j];
+          p_im[j]   = p_re[j] * w_im[j] + p_im[j] * w_re[j];
+          p_re[j]   = re;
+        }
+      }
+    }
+
+    for (size_t j = 0; j < count; j++)
+      F[j] = complex<double>(F_re[j], F_im[j]);
+  }
+
+} //end empty namespace
+
+
 namespace radsim {
 
 // These functions create numerically evaluated fourier transform functions of F(f) = integral(G(t) * exp(-2*pi*i*t*f) dt)
@@ -21,15 +85,13 @@ namespace radsim {
 template <class T>
 complex<double> fourierTransformSingle(const ApproxFunction<T>& G, double f, 
                                        double dt, double t_start, double t_end, bool Inverse) {
-  complex<double> F = 0;
-  double t;
-  double Sign = -1;
-  if (Inverse)
-    Sign = 1;
-  for (t = t_start; t < t_end; t += dt)
-    F += G.output(t) * exp(Sign * 2 * pi * 1i * t * f);
-  F *= dt;
-  return F;
+  vector<T> samples;
+  vector<double> times;
+  sampleFunction(G, dt, t_start, t_end, samples, times);
+
+  complex<double> F;
+  transformBlock(samples, times, dt, &f, &F, 1, Inverse ? 1 : -1);
+  return F * dt;
 }
 
 template complex<double> fourierTransformSingle(const DoubleApproxFunction& G, double f, 
@@ -39,22 +101,104 @@ template complex<double> fourierTransformSingle(const ComplexApproxFunction& G,
                                                 double dt, double t_start, double t_end, bool Inverse);
 
 template <class T>
-ComplexApproxFunction fourierTransform( const ApproxFunction<T>& G, vector<double> entry, 
-                                        double dt, double t_start, double t_end, bool Inverse) {
-  vector<complex<double> > value(entry.size());
+vector<complex<double>> nonUniformFourierTransform( const ApproxFunction<T>& G, const vector<double>& f, 
+                                                    double dt, double t_start, double t_end, bool Inverse,
+                                                    ThreadPool * pool) {
+  vector<T> samples;
+  vector<double> times;
+  sampleFunction(G, dt, t_start, t_end, samples, times);
+
+  vector<complex<double> > value(f.size());
+  double Sign = Inverse ? 1 : -1;
+  size_t num_blocks = (f.size() + frequency_block - 1) / frequency_block;
+  auto func = [&](size_t block) {
+    size_t first = block * frequency_block;
+    size_t count = min(frequency_block, f.size() - first);
+    transformBlock(samples, times, dt, f.data() + first, value.data() + first, count, Sign);
+    for (size_t n = first; n < first + count; n++)
+      value[n] *= dt;
+  };
+
+  if (pool)
+    pool->parallelFor(0, num_blocks, func);
+  else
+    for (size_t block = 0; block < num_blocks; block++)
+      func(block);
+
+  return value;
+}
+
+template vector<complex<double>> nonUniformFourierTransform( const DoubleApproxFunction& G, const vector<double>& f, 
+                                                             double dt, double t_start, double t_end, bool Inverse,
+                                                             ThreadPool * pool);
+
+template vector<complex<double>> nonUniformFourierTransform( const ComplexApproxFunction& G, const vector<double>& f, 
+                                                             double dt, double t_start, double t_end, bool Inverse,
+                                                             ThreadPool * pool);
 
-  for (int n = 0; n < entry.size(); n++)
-     value[n] = fourierTransformSingle(G, entry[n], dt, t_start, t_end, Inverse);
+template <class T>
+ComplexApproxFunction fourierTransform( const ApproxFunction<T>& G, vector<double> entry, 
+                                        double dt, double t_start, double t_end, bool Inverse,
+                                        ThreadPool * pool) {
+  vector<complex<double> > value = nonUniformFourierTransform(G, entry, dt, t_start, t_end, Inverse, pool);
   return ComplexApproxFunction( move(entry), move(value) );    
 }
 
 template ComplexApproxFunction fourierTransform( const DoubleApproxFunction& G, vector<double> entry, 
-                                                 double dt, double t_start, double t_end, bool Inverse);
+                                                 double dt, double t_start, double t_end, bool Inverse,
+                                                 ThreadPool * pool);
 
 template ComplexApproxFunction fourierTransform( const ComplexApproxFunction& G, vector<double> entry, 
-                                                 double dt, double t_start, double t_end, bool Inverse);
+                                                 double dt, double t_start, double t_end, bool Inverse,
+                                                 ThreadPool * pool);
+
 
+
+//With f_k = (k - N/2) / (N * dt), the sum over exp(-+2*pi*i*f_k*n*dt) is a discrete transform of 
+//the samples modulated with (-1)^n. The phase of t_start is applied per entry.
+template <class T>
+ComplexApproxFunction fastFourierTransform( const ApproxFunction<T>& G, size_t N, 
+                                            double dt, double t_start, bool Inverse) {
+  if (N == 0 || N % 2 != 0)
+    throw invalid_argument(__PRETTY_FUNCTION__ + string(": number of samples must be even."));
+
+  vector<complex<double>> value(N);
+  if constexpr (is_same_v<T, double>) {
+    vector<double> samples(N);
+    for (size_t n = 0; n < N; n++)
+      samples[n] = (n % 2 ? -1 : 1) * G.output(t_start + n * dt);
+
+    //the transform of real samples is conjugate symmetric, and the inverse sum is its conjugate
+    RealFFTPlan::get(N)->execute(samples.data(), value.data());
+    for (size_t k = N / 2 + 1; k < N; k++)
+      value[k] = conj(value[N - k]);
+    if (Inverse)
+      for (auto& X : value)
+        X = conj(X);
+  }
+  else {
+    for (size_t n = 0; n < N; n++)
+      value[n] = (n % 2 ? -1.0 : 1.0) * G.output(t_start + n * dt);
+
+    FFTPlan::get(N)->execute(value.data(), Inverse);
+    if (Inverse)
+      for (auto& X : value)
+        X *= (double) N; //unscaled sum
+  }
+
+  double Sign = Inverse ? 1 : -1;
+  vector<double> entry(N);
+  for (size_t k = 0; k < N; k++) {
+    entry[k] = (k - 0.5 * N) / (N * dt);
+    value[k] *= dt * polar(1.0, Sign * 2 * pi * entry[k] * t_start);
+  }
+  return ComplexApproxFunction( move(entry), move(value) );
 }
 
+template ComplexApproxFunction fastFourierTransform( const DoubleApproxFunction& G, size_t N, 
+                                                     double dt, double t_start, bool Inverse);
 
+template ComplexApproxFunction fastFourierTransform( const ComplexApproxFunction& G, size_t N, 
+                                                     double dt, double t_start, bool Inverse);
 
+}
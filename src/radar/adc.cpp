@@ -89,4 +89,18 @@ unsigned short ADC::convertSignal(double power) const
   }
 }
 
+//unit
+short ADC::convertAmplitude(double amplitude) const
+//amplitude: amp
+{
+  int max_level = num_levels / 2 - 1; //unit
+  double level = amplitude * max_level / sqrt(maximum_power); //unit
+  if (level >= max_level)
+    return max_level; //unit
+  if (level <= -max_level)
+    return -max_level; //unit
+
+  return (short) level; //unit
+}
+
 } //end namespace bkradsim
@@ -0,0 +1,94 @@
+#include <math.h>
+
+#include <stdexcept>
+#include <string>
+#include <random>
+
+#include <radsim/mathematics/constants.hpp>
+#include <radsim/mathematics/mathutils.hpp>
+
+#include <radsim/radar/clutter_map.hpp>
+
+using namespace std;
+
+namespace radsim {
+
+ClutterMap::ClutterMap(double cell_width_arg, int num_range_bins_arg, double shape_arg, unsigned int seed_arg) :
+  cell_width( cell_width_arg ),
+  num_range_bins( num_range_bins_arg ),
+  shape( shape_arg ),
+  seed( seed_arg )
+{
+  if (cell_width <= 0 || cell_width > 2 * pi)
+    throw invalid_argument(__PRETTY_FUNCTION__ + string(": azimuth cell width must be in <0, 2pi]."));
+  if (shape <= 0)
+    throw invalid_argument(__PRETTY_FUNCTION__ + string(": clutter shape parameter must be positive."));
+
+  num_cells = ceil(2 * pi / cell_width);
+  texture.resize(num_cells);
+}
+
+
+void ClutterMap::generateCell(int cell) {
+  mt19937 engine( seed ^ (2654435761u * (cell + 1)) );
+  gamma_distribution<float> gamma(shape, 1.0 / shape); //mean 1
+
+  auto& values = texture[cell];
+  values.resize(num_range_bins);
+  for (auto& value : values)
+    value = gamma(engine);
+}
+
+
+//unit
+const float * ClutterMap::getTexture(int cell) {
+  if (cell < 0 || cell >= num_cells)
+    throw invalid_argument(__PRETTY_FUNCTION__ + string(": azimuth cell out of range."));
+
+  if (texture[cell].empty())
+    generateCell(cell);
+  return texture[cell].data(); //unit
+}
+
+
+int ClutterMap::findCell(double theta) const
+//theta: rad
+{
+  setRadDefaultRange(theta);
+  int cell = theta / cell_width;
+  return cell < num_cells ? cell : num_cells - 1;
+}
+
+
+int ClutterMap::getNumCells() const {
+  return num_cells;
+}
+
+
+int ClutterMap::getNumCachedCells() const {
+  int num_cached = 0;
+  for (const auto& values : texture)
+    if (!values.empty())
+      num_cached++;
+  return num_cached;
+}
+
+
+//unit
+double ClutterMap::getShape() const {
+  return shape; //unit
+}
+
+
+void ClutterMap::setSeed(unsigned int seed_arg) {
+  seed = seed_arg;
+  clear();
+}
+
+
+void ClutterMap::clear() {
+  for (auto& values : texture)
+    values = vector<float>();
+}
+
+}
@@ -0,0 +1,104 @@
+#include <stdexcept>
+#include <string>
+#include <exception>
+
+#include <radsim/radar/distributed.hpp>
+
+using namespace std;
+
+namespace {
+
+  //the first index of the share of rank, of num_indices split over num_ranks
+  size_t shareBegin(size_t num_indices, int rank, int num_ranks) {
+    return num_indices * rank / num_ranks;
+  }
+
+  void getRankAndSize(MPI_Comm comm, int& rank, int& num_ranks) {
+    MPI_Comm_rank(comm, &rank);
+    MPI_Comm_size(comm, &num_ranks);
+  }
+
+} //end empty namespace
+
+
+namespace radsim {
+
+template <class T>
+MonteCarloResult runDistributed(BasicMonteCarloRunner<T>& runner, size_t num_trials,
+                                const typename BasicMonteCarloRunner<T>::TargetGenerator& generator,
+                                const typename BasicMonteCarloRunner<T>::Detector& detector,
+                                MPI_Comm comm)
+{
+  int rank, num_ranks;
+  getRankAndSize(comm, rank, num_ranks);
+
+  size_t first = shareBegin(num_trials, rank, num_ranks);
+  size_t end = shareBegin(num_trials, rank + 1, num_ranks);
+  MonteCarloResult share = runner.run(first, end, generator, detector);
+
+  unsigned long local_counts[2] = {share.getNumDetections(), share.getNumOpportunities()};
+  unsigned long counts[2];
+  MPI_Allreduce(local_counts, counts, 2, MPI_UNSIGNED_LONG, MPI_SUM, comm);
+  return MonteCarloResult(num_trials, counts[0], counts[1]);
+}
+
+
+SweepTable runDistributed(ParameterSweep& sweep, const ParameterSweep::Metric& metric,
+                          const vector<string>& metric_names, MPI_Comm comm)
+{
+  int rank, num_ranks;
+  getRankAndSize(comm, rank, num_ranks);
+
+  size_t num_points = sweep.getNumPoints();
+  vector<int> counts(num_ranks);
+  vector<int> displacements(num_ranks);
+  for (int n = 0; n < num_ranks; n++) {
+    displacements[n] = shareBegin(num_points, n, num_ranks);
+    counts[n] = shareBegin(num_points, n + 1, num_ranks) - displacements[n];
+  }
+
+  //every rank must take part in the collectives below, also when its own share failed
+  exception_ptr error;
+  vector<string> names;
+  vector<vector<double>> local_columns;
+  try {
+    SweepTable share = sweep.run(metric, metric_names, displacements[rank], displacements[rank] + counts[rank]);
+    names = share.getColumnNames();
+    for (size_t n = 0; n < share.getNumColumns(); n++)
+      local_columns.push_back( share.getColumn(n) );
+  }
+  catch (...) {
+    error = current_exception();
+  }
+
+  int local_failed = error ? 1 : 0;
+  int failed = 0;
+  MPI_Allreduce(&local_failed, &failed, 1, MPI_INT, MPI_MAX, comm);
+  if (error)
+    rethrow_exception(error);
+  if (failed)
+    throw runtime_error(__PRETTY_FUNCTION__ + string(": the sweep failed on another rank."));
+
+  vector<vector<double>> columns(local_columns.size(), vector<double>(num_points));
+  for (size_t n = 0; n < columns.size(); n++)
+    MPI_Allgatherv(local_columns[n].data(), counts[rank], MPI_DOUBLE,
+                   columns[n].data(), counts.data(), displacements.data(), MPI_DOUBLE, comm);
+
+  return SweepTable( move(names), move(columns) );
+}
+
+
+template MonteCarloResult runDistributed(BasicMonteCarloRunner<unsigned short>& runner, size_t num_trials,
+                                         const BasicMonteCarloRunner<unsigned short>::TargetGenerator& generator,
+                                         const BasicMonteCarloRunner<unsigned short>::Detector& detector,
+                                         MPI_Comm comm);
+template MonteCarloResult runDistributed(BasicMonteCarloRunner<unsigned char>& runner, size_t num_trials,
+                                         const BasicMonteCarloRunner<unsigned char>::TargetGenerator& generator,
+                                         const BasicMonteCarloRunner<unsigned char>::Detector& detector,
+                                         MPI_Comm comm);
+template MonteCarloResult runDistributed(BasicMonteCarloRunner<short>& runner, size_t num_trials,
+                                         const BasicMonteCarloRunner<short>::TargetGenerator& generator,
+                                         const BasicMonteCarloRunner<short>::Detector& detector,
+                                         MPI_Comm comm);
+
+}
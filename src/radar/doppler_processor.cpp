@@ -0,0 +1,200 @@
+#include <stdexcept>
+#include <string>
+#include <algorithm>
+
+#include <radsim/mathematics/fft.hpp>
+
+#include <radsim/radar/doppler_processor.hpp>
+
+using namespace std;
+
+namespace {
+
+  const int max_block_size = 16; //pulses
+  const int range_tile = 64; //range bins per transposed tile
+
+}
+
+namespace radsim {
+
+RangeDopplerMap::RangeDopplerMap(double t_start_arg, double t_end_arg, math_vector boresight_arg, 
+                                 int num_range_bins_arg, int num_doppler_bins_arg, double prt_arg) :
+  t_start( t_start_arg ),
+  t_end( t_end_arg ),
+  boresight( boresight_arg ),
+  num_range_bins( num_range_bins_arg ),
+  num_doppler_bins( num_doppler_bins_arg ),
+  prt( prt_arg ),
+  power( (size_t) num_range_bins_arg * num_doppler_bins_arg, 0 )
+{
+}
+
+//s
+double RangeDopplerMap::getStartTime() const {
+  return t_start; //s
+}
+
+//s
+double RangeDopplerMap::getEndTime() const {
+  return t_end; //s
+}
+
+//unit
+math_vector RangeDopplerMap::getBoresight() const {
+  return boresight;
+}
+
+int RangeDopplerMap::getNumRangeBins() const {
+  return num_range_bins;
+}
+
+int RangeDopplerMap::getNumDopplerBins() const {
+  return num_doppler_bins;
+}
+
+//unit
+double RangeDopplerMap::getPower(int range_bin, int doppler_bin) const {
+  return power[(size_t) range_bin * num_doppler_bins + doppler_bin]; //unit
+}
+
+//hz
+double RangeDopplerMap::getDopplerFrequency(int doppler_bin) const {
+  int k = doppler_bin;
+  if (k >= num_doppler_bins / 2)
+    k -= num_doppler_bins;
+  return k / (num_doppler_bins * prt); //hz
+}
+
+int RangeDopplerMap::findPeakDopplerBin(int range_bin) const {
+  auto first = power.begin() + (size_t) range_bin * num_doppler_bins;
+  return max_element(first, first + num_doppler_bins) - first;
+}
+
+
+
+//called first in the initializer list, so that no FFT plan or thread pool is built for bad arguments
+int DopplerProcessor::checkArguments(int num_pulses_arg, int num_range_bins_arg, double prt_arg) {
+  if (num_pulses_arg < 2 || !isPowerOfTwo(num_pulses_arg))
+    throw invalid_argument(__PRETTY_FUNCTION__ + string(": number of pulses in a CPI must be a power of 2, and at least 2."));
+  if (num_range_bins_arg < 1)
+    throw invalid_argument(__PRETTY_FUNCTION__ + string(": number of range bins must be positive."));
+  if (prt_arg <= 0)
+    throw invalid_argument(__PRETTY_FUNCTION__ + string(": PRT must be positive."));
+  return num_pulses_arg;
+}
+
+
+DopplerProcessor::DopplerProcessor(int num_pulses_arg, int num_range_bins_arg, double prt_arg, int num_threads) :
+  num_pulses( checkArguments(num_pulses_arg, num_range_bins_arg, prt_arg) ),
+  num_range_bins( num_range_bins_arg ),
+  prt( prt_arg ),
+  block_size( min(num_pulses_arg, max_block_size) ),
+  num_in_block( 0 ),
+  num_collected( 0 ),
+  t_start( 0 ),
+  t_end( 0 ),
+  boresight_sum( {0, 0, 0} ),
+  plan( num_pulses_arg ),
+  pool( num_threads )
+{
+  cube.resize( (size_t) num_range_bins * num_pulses );
+  block.resize( (size_t) block_size * num_range_bins );
+}
+
+
+//copies the staged pulses into their columns of the cube, one range tile at a time, 
+//so that both the read and the written cache lines are reused within the tile.
+void DopplerProcessor::transposeBlock() {
+  int first_pulse = num_collected - num_in_block;
+  for (int r0 = 0; r0 < num_range_bins; r0 += range_tile) {
+    int r1 = min(r0 + range_tile, num_range_bins);
+    for (int r = r0; r < r1; r++) {
+      complex<double> * dst = cube.data() + (size_t) r * num_pulses + first_pulse;
+      const complex<double> * src = block.data() + r;
+      for (int p = 0; p < num_in_block; p++)
+        dst[p] = src[(size_t) p * num_range_bins];
+    }
+  }
+  num_in_block = 0;
+}
+
+
+void DopplerProcessor::process() {
+  completed.emplace_back(t_start, t_end, math_vector_unit(boresight_sum), num_range_bins, num_pulses, prt);
+  double * power = completed.back().power.data();
+
+  pool.parallelFor(0, num_range_bins, [&](size_t r) {
+    complex<double> * samples = cube.data() + r * num_pulses;
+    plan.execute(samples);
+    double * out = power + r * num_pulses;
+    for (int k = 0; k < num_pulses; k++)
+      out[k] = norm(samples[k]);
+  });
+
+  num_collected = 0;
+  boresight_sum = {0, 0, 0};
+}
+
+
+bool DopplerProcessor::add(const IQPulseData& pulse_data) {
+  const auto& registry = pulse_data.registry;
+  if (registry.size() != 2 * (size_t) num_range_bins)
+    throw invalid_argument(__PRETTY_FUNCTION__ + string(": registry size does not match the number of range bins."));
+
+  if (num_collected == 0)
+    t_start = pulse_data.getStartTime(); //s
+  t_end = pulse_data.getStartTime(); //s
+  boresight_sum = boresight_sum + pulse_data.getBoresight();
+
+  complex<double> * dst = block.data() + (size_t) num_in_block * num_range_bins;
+  const short * iq = registry.data();
+  for (int r = 0; r < num_range_bins; r++)
+    dst[r] = complex<double>(iq[2 * r], iq[2 * r + 1]);
+  num_in_block++;
+  num_collected++;
+
+  if (num_in_block == block_size || num_collected == num_pulses)
+    transposeBlock();
+
+  if (num_collected == num_pulses)
+    process();
+
+  return ready();
+}
+
+
+bool DopplerProcessor::consume(IQRadarInterface& com) {
+  while (com.dataReady())
+    add( com.getData() );
+  return ready();
+}
+
+
+bool DopplerProcessor::ready() const {
+  return !completed.empty();
+}
+
+
+RangeDopplerMap DopplerProcessor::getMap() {
+  if (completed.empty())
+    throw logic_error(__PRETTY_FUNCTION__ + string(": no range-doppler map. Check ready() first."));
+
+  RangeDopplerMap map = move(completed.front());
+  completed.pop_front();
+  return map;
+}
+
+
+void DopplerProcessor::reset() {
+  completed.clear();
+  num_in_block = 0;
+  num_collected = 0;
+  boresight_sum = {0, 0, 0};
+}
+
+
+int DopplerProcessor::getNumPulses() const {
+  return num_pulses;
+}
+
+}
@@ -0,0 +1,210 @@
+#include <math.h>
+
+#include <stdexcept>
+#include <string>
+#include <atomic>
+
+#include <radsim/radar/monte_carlo.hpp>
+
+using namespace std;
+using namespace radsim;
+
+namespace {
+
+  //unit, the z for which a standard normal variable is within [-z, z] with probability confidence
+  double normalQuantile(double confidence) {
+    double low = 0;
+    double high = 40;
+    for (int n = 0; n < 100; n++) {
+      double z = 0.5 * (low + high);
+      if (erf(z / sqrt(2.0)) < confidence)
+        low = z;
+      else
+        high = z;
+    }
+    return 0.5 * (low + high);
+  }
+
+  //splitmix64 finalizer
+  unsigned long long mix(unsigned long long x) {
+    x ^= x >> 30;
+    x *= 0xbf58476d1ce4e5b9ULL;
+    x ^= x >> 27;
+    x *= 0x94d049bb133111ebULL;
+    x ^= x >> 31;
+    return x;
+  }
+
+} //end empty namespace
+
+
+namespace radsim {
+
+DetectionCount::DetectionCount(bool detected) :
+  detections( detected ? 1 : 0 ),
+  opportunities( 1 )
+{
+}
+
+DetectionCount::DetectionCount(unsigned long detections_arg, unsigned long opportunities_arg) :
+  detections( detections_arg ),
+  opportunities( opportunities_arg )
+{
+}
+
+
+MonteCarloResult::MonteCarloResult(unsigned long num_trials_arg, unsigned long num_detections_arg, unsigned long num_opportunities_arg) :
+  num_trials( num_trials_arg ),
+  num_detections( num_detections_arg ),
+  num_opportunities( num_opportunities_arg )
+{
+}
+
+unsigned long MonteCarloResult::getNumTrials() const {
+  return num_trials;
+}
+
+unsigned long MonteCarloResult::getNumDetections() const {
+  return num_detections;
+}
+
+unsigned long MonteCarloResult::getNumOpportunities() const {
+  return num_opportunities;
+}
+
+//unit
+double MonteCarloResult::getProbability() const {
+  if (num_opportunities == 0)
+    return 0; //unit
+  return (double) num_detections / (double) num_opportunities; //unit
+}
+
+//unit
+pair<double, double> MonteCarloResult::getConfidenceInterval(double confidence) const
+//confidence: <0, 1>
+{
+  if (confidence <= 0 || confidence >= 1)
+    throw invalid_argument(__PRETTY_FUNCTION__ + string(": confidence must be in <0, 1>."));
+  if (num_opportunities == 0)
+    return {0, 1}; //unit
+
+  double n = num_opportunities;
+  double p = getProbability(); //unit
+  double z = normalQuantile(confidence); //unit
+  double z2 = z * z;
+  double denominator = 1 + z2 / n;
+  double center = (p + z2 / (2 * n)) / denominator; //unit
+  double half_width = z / denominator * sqrt(p * (1 - p) / n + z2 / (4 * n * n)); //unit
+  return {max(0.0, center - half_width), min(1.0, center + half_width)}; //unit
+}
+
+
+template <class T>
+BasicMonteCarloRunner<T>::BasicMonteCarloRunner(const RadarConfig& config, unsigned long seed_arg, int num_threads) :
+  pool( num_threads ),
+  seed( seed_arg ),
+  shard_size( 1024 )
+{
+  for (int n = 0; n < pool.getNumThreads(); n++) {
+    radars.emplace_back( new Radar(config) );
+    radars.back()->setRandomParameters(getTrialSeed(seed, 0), &RNG::splitmix64);
+  }
+
+  radars.front()->checkSampleType<T>();
+}
+
+
+template <class T>
+void BasicMonteCarloRunner<T>::setupRadars(const function<void(Radar&)>& func) {
+  for (auto& radar : radars)
+    func(*radar);
+}
+
+template <class T>
+void BasicMonteCarloRunner<T>::setSeed(unsigned long seed_arg) {
+  seed = seed_arg;
+}
+
+template <class T>
+unsigned long BasicMonteCarloRunner<T>::getSeed() const {
+  return seed;
+}
+
+template <class T>
+void BasicMonteCarloRunner<T>::setShardSize(size_t size) {
+  if (size == 0)
+    throw invalid_argument(__PRETTY_FUNCTION__ + string(": shard size must be positive."));
+  shard_size = size;
+}
+
+template <class T>
+size_t BasicMonteCarloRunner<T>::getShardSize() const {
+  return shard_size;
+}
+
+template <class T>
+int BasicMonteCarloRunner<T>::getNumThreads() const {
+  return pool.getNumThreads();
+}
+
+
+//The splitmix64 state steps by a fixed odd increment per number, so the trial states are placed 2^32 
+//numbers apart on that sequence. Every trial can draw 2^32 numbers before it reaches the next stream.
+template <class T>
+uint64_t BasicMonteCarloRunner<T>::getTrialSeed(unsigned long seed, size_t trial) {
+  return mix(seed) + (uint64_t) trial * (RNG::splitmix64_increment << 32);
+}
+
+
+template <class T>
+MonteCarloResult BasicMonteCarloRunner<T>::run(size_t num_trials, const TargetGenerator& generator, const Detector& detector) {
+  return run(0, num_trials, generator, detector);
+}
+
+
+//Every thread takes shards from a shared counter, and stores the counts of each shard by shard index.
+//The shards are summed in index order after the loop.
+template <class T>
+MonteCarloResult BasicMonteCarloRunner<T>::run(size_t first_trial, size_t end_trial, const TargetGenerator& generator, const Detector& detector) {
+  if (!generator || !detector)
+    throw invalid_argument(__PRETTY_FUNCTION__ + string(": target generator and detector must be set."));
+  if (first_trial > end_trial)
+    throw invalid_argument(__PRETTY_FUNCTION__ + string(": first trial must not be after end trial."));
+
+  size_t num_trials = end_trial - first_trial;
+  size_t num_shards = (num_trials + shard_size - 1) / shard_size;
+  vector<DetectionCount> shard_counts(num_shards, DetectionCount(0, 0));
+  atomic<size_t> next_shard( 0 );
+
+  pool.parallelFor(0, radars.size(), [&](size_t thread_index) {
+    Radar& radar = *radars[thread_index];
+    size_t shard;
+    while ((shard = next_shard++) < num_shards) {
+      DetectionCount& count = shard_counts[shard];
+      size_t end = first_trial + min(num_trials, (shard + 1) * shard_size);
+      for (size_t trial = first_trial + shard * shard_size; trial < end; trial++) {
+        radar.setRandomSeed(getTrialSeed(seed, trial));
+        radar.reset(0);
+        TargetCollection targets = generator(trial);
+        DetectionCount trial_count = detector(radar.generate<T>(targets), trial);
+        count.detections += trial_count.detections;
+        count.opportunities += trial_count.opportunities;
+      }
+    }
+  });
+
+  unsigned long num_detections = 0;
+  unsigned long num_opportunities = 0;
+  for (const DetectionCount& count : shard_counts) {
+    num_detections += count.detections;
+    num_opportunities += count.opportunities;
+  }
+  return MonteCarloResult(num_trials, num_detections, num_opportunities);
+}
+
+
+template class BasicMonteCarloRunner<unsigned short>;
+template class BasicMonteCarloRunner<unsigned char>;
+template class BasicMonteCarloRunner<short>;
+
+}
@@ -0,0 +1,178 @@
+#include <stdexcept>
+#include <string>
+#include <exception>
+#include <limits>
+
+#include <radsim/radar/parameter_sweep.hpp>
+
+using namespace std;
+
+namespace radsim {
+
+SweepTable::SweepTable(vector<string> names_arg, vector<vector<double>> columns_arg) :
+  names( move(names_arg) ),
+  columns( move(columns_arg) )
+{
+  if (names.size() != columns.size())
+    throw invalid_argument(__PRETTY_FUNCTION__ + string(": there must be one name per column."));
+  for (const auto& column : columns)
+    if (column.size() != columns.front().size())
+      throw invalid_argument(__PRETTY_FUNCTION__ + string(": all columns must be of equal size."));
+}
+
+size_t SweepTable::getNumRows() const {
+  if (columns.empty())
+    return 0;
+  return columns.front().size();
+}
+
+size_t SweepTable::getNumColumns() const {
+  return columns.size();
+}
+
+const vector<string>& SweepTable::getColumnNames() const {
+  return names;
+}
+
+size_t SweepTable::findColumn(const string& name) const {
+  for (size_t n = 0; n < names.size(); n++)
+    if (names[n] == name)
+      return n;
+  throw invalid_argument(__PRETTY_FUNCTION__ + string(": no column named '") + name + string("'."));
+}
+
+const vector<double>& SweepTable::getColumn(size_t index) const {
+  if (index >= columns.size())
+    throw invalid_argument(__PRETTY_FUNCTION__ + string(": invalid column index."));
+  return columns[index];
+}
+
+const vector<double>& SweepTable::getColumn(const string& name) const {
+  return columns[findColumn(name)];
+}
+
+void SweepTable::writeCSV(ostream& out) const {
+  for (size_t n = 0; n < names.size(); n++)
+    out << (n ? "," : "") << names[n];
+  out << "\n";
+
+  auto precision = out.precision( numeric_limits<double>::max_digits10 );
+  for (size_t row = 0; row < getNumRows(); row++) {
+    for (size_t n = 0; n < columns.size(); n++)
+      out << (n ? "," : "") << columns[n][row];
+    out << "\n";
+  }
+  out.precision(precision);
+}
+
+
+ParameterSweep::ParameterSweep(const RadarConfig& base_config_arg, int num_threads) :
+  base_config( base_config_arg ),
+  pool( num_threads )
+{
+}
+
+
+void ParameterSweep::addAxis(const string& keyword, vector<double> values) {
+  if (values.empty())
+    throw invalid_argument(__PRETTY_FUNCTION__ + string(": axis '") + keyword + string("' has no values."));
+  for (const string& name : axis_names)
+    if (name == keyword)
+      throw invalid_argument(__PRETTY_FUNCTION__ + string(": keyword '") + keyword + string("' is already an axis."));
+
+  RadarConfig config = base_config;
+  for (double value : values)
+    parser.setKeyword(config, keyword, value); //throws on keywords that cannot be swept
+
+  axis_names.push_back(keyword);
+  axis_values.push_back( move(values) );
+}
+
+size_t ParameterSweep::getNumAxes() const {
+  return axis_names.size();
+}
+
+size_t ParameterSweep::getNumPoints() const {
+  size_t num_points = 1;
+  for (const auto& values : axis_values)
+    num_points *= values.size();
+  return num_points;
+}
+
+int ParameterSweep::getNumThreads() const {
+  return pool.getNumThreads();
+}
+
+
+//The last axis varies fastest
+vector<double> ParameterSweep::getPointValues(size_t point) const {
+  if (point >= getNumPoints())
+    throw invalid_argument(__PRETTY_FUNCTION__ + string(": invalid point index."));
+
+  vector<double> values(axis_values.size());
+  for (size_t n = axis_values.size(); n-- > 0;) {
+    values[n] = axis_values[n][point % axis_values[n].size()];
+    point /= axis_values[n].size();
+  }
+  return values;
+}
+
+RadarConfig ParameterSweep::getConfig(size_t point) const {
+  vector<double> values = getPointValues(point);
+  RadarConfig config = base_config;
+  for (size_t n = 0; n < values.size(); n++)
+    parser.setKeyword(config, axis_names[n], values[n]);
+  return config;
+}
+
+
+//Every point is built and evaluated by itself, exceptions are stored per point and rethrown
+//in point order after the loop, since the pool does not allow func to throw.
+SweepTable ParameterSweep::run(const Metric& metric, const vector<string>& metric_names, size_t first_point, size_t end_point) {
+  if (!metric)
+    throw invalid_argument(__PRETTY_FUNCTION__ + string(": metric must be set."));
+  if (first_point > end_point || end_point > getNumPoints())
+    throw invalid_argument(__PRETTY_FUNCTION__ + string(": invalid point range."));
+
+  size_t num_points = end_point - first_point;
+  size_t num_axes = axis_names.size();
+  size_t num_metrics = metric_names.size();
+
+  vector<vector<double>> columns(num_axes + num_metrics, vector<double>(num_points));
+  vector<exception_ptr> errors(num_points);
+
+  pool.parallelFor(0, num_points, [&](size_t row) {
+    try {
+      size_t point = first_point + row;
+      vector<double> values = getPointValues(point);
+      for (size_t n = 0; n < num_axes; n++)
+        columns[n][row] = values[n];
+
+      Radar radar( getConfig(point) );
+      vector<double> metrics = metric(radar, point);
+      if (metrics.size() != num_metrics)
+        throw invalid_argument(__PRETTY_FUNCTION__ + string(": metric returned ") + std::to_string(metrics.size()) +
+                               string(" values, expected ") + std::to_string(num_metrics) + string("."));
+      for (size_t n = 0; n < num_metrics; n++)
+        columns[num_axes + n][row] = metrics[n];
+    }
+    catch (...) {
+      errors[row] = current_exception();
+    }
+  }, 1);
+
+  for (const exception_ptr& error : errors)
+    if (error)
+      rethrow_exception(error);
+
+  vector<string> names = axis_names;
+  names.insert(names.end(), metric_names.begin(), metric_names.end());
+  return SweepTable( move(names), move(columns) );
+}
+
+
+SweepTable ParameterSweep::run(const Metric& metric, const vector<string>& metric_names) {
+  return run(metric, metric_names, 0, getNumPoints());
+}
+
+}
@@ -0,0 +1,91 @@
+#include <stdexcept>
+#include <string>
+#include <algorithm>
+
+#include <radsim/radar/pulse_compressor.hpp>
+
+using namespace std;
+
+namespace {
+
+  //FFT size of about 4 replica lengths keeps the overlap of the blocks small,
+  //but it is never larger than what is needed for the whole registry in one block.
+  size_t chooseFFTSize(size_t replica_length, size_t num_range_bins) {
+    size_t size = radsim::nextPowerOfTwo(4 * replica_length);
+    size_t single_block = radsim::nextPowerOfTwo(num_range_bins + replica_length - 1);
+    return min(size, single_block);
+  }
+
+}
+
+namespace radsim {
+
+PulseCompressor::PulseCompressor(const Radar& radar) :
+  num_range_bins( radar.getNumRangeBins() ),
+  replica_length( radar.getPulseReplica().size() ),
+  block_step( 0 ),
+  plan( chooseFFTSize(replica_length, num_range_bins) )
+{
+  size_t N = plan.size();
+  block_step = N - replica_length + 1;
+
+  vector<complex<double>> replica = radar.getPulseReplica();
+  reference_spectrum.assign(N, 0);
+  copy(replica.begin(), replica.end(), reference_spectrum.begin());
+  plan.execute(reference_spectrum.data());
+  for (auto& value : reference_spectrum)
+    value = conj(value) / (double) replica_length;
+
+  buffer.resize(N);
+}
+
+
+void PulseCompressor::compress(const IQPulseData& pulse_data, vector<complex<double>>& output) {
+  const auto& registry = pulse_data.registry;
+  if (registry.size() != 2 * (size_t) num_range_bins)
+    throw invalid_argument(__PRETTY_FUNCTION__ + string(": registry size does not match the number of range bins."));
+
+  output.resize(num_range_bins);
+  size_t N = plan.size();
+  const short * iq = registry.data();
+
+  for (size_t start = 0; start < (size_t) num_range_bins; start += block_step) {
+    size_t num_in = min(N, num_range_bins - start);
+    for (size_t n = 0; n < num_in; n++)
+      buffer[n] = complex<double>( iq[2 * (start + n)], iq[2 * (start + n) + 1] );
+    fill(buffer.begin() + num_in, buffer.end(), 0);
+
+    plan.execute(buffer.data());
+    double * x = reinterpret_cast<double *>(buffer.data());
+    const double * h = reinterpret_cast<const double *>(reference_spectrum.data());
+    for (size_t k = 0; k < N; k++) {
+      double re = x[2 * k] * h[2 * k] - x[2 * k + 1] * h[2 * k + 1];
+      double im = x[2 * k] * h[2 * k + 1] + x[2 * k + 1] * h[2 * k];
+      x[2 * k]     = re;
+      x[2 * k + 1] = im;
+    }
+    plan.execute(buffer.data(), true);
+
+    size_t num_out = min(block_step, num_range_bins - start);
+    copy(buffer.begin(), buffer.begin() + num_out, output.begin() + start);
+  }
+}
+
+
+vector<complex<double>> PulseCompressor::compress(const IQPulseData& pulse_data) {
+  vector<complex<double>> output;
+  compress(pulse_data, output);
+  return output;
+}
+
+
+int PulseCompressor::getReplicaLength() const {
+  return replica_length;
+}
+
+
+size_t PulseCompressor::getFFTSize() const {
+  return plan.size();
+}
+
+}
@@ -4,7 +4,8 @@ using namespace std;
 
 namespace radsim {
 
-PulseData::PulseData(double t, math_vector boresight_arg, vector<unsigned short> registry_arg) {
+template <class T>
+BasicPulseData<T>::BasicPulseData(double t, math_vector boresight_arg, vector<T> registry_arg) {
   origin_reg = registry_arg.data();
   t_start = t;
   boresight = boresight_arg,
@@ -12,20 +13,28 @@ PulseData::PulseData(double t, math_vector boresight_arg, vector<unsigned short>
   origin_data = this;
 }
 
-bool PulseData::isOriginal() const {
+template <class T>
+bool BasicPulseData<T>::isOriginal() const {
   return (origin_data == this);
 }
 
-bool PulseData::hasOriginalRegistry() const {
+template <class T>
+bool BasicPulseData<T>::hasOriginalRegistry() const {
   return (origin_reg == registry.data());
 }
 
-double PulseData::getStartTime() const {
+template <class T>
+double BasicPulseData<T>::getStartTime() const {
   return t_start;
 }
 
-math_vector PulseData::getBoresight() const {
+template <class T>
+math_vector BasicPulseData<T>::getBoresight() const {
   return boresight;
 }
 
+template class BasicPulseData<unsigned short>;
+template class BasicPulseData<unsigned char>;
+template class BasicPulseData<short>;
+
 }
@@ -1,27 +1,39 @@
 #include <vector>
 #include <iostream>
+#include <limits>
 
 #include <radsim/mathematics/math_vector.hpp>
 
 #include <radsim/radar/pulse_data.hpp>
 #include <radsim/radar/pulse_data_reader.hpp>
 
-using namespace radsim;
 using namespace std;
 
-PulseDataReader::PulseDataReader(const std::string filename) :
+namespace radsim {
+
+template <class T>
+BasicPulseDataReader<T>::BasicPulseDataReader(const std::string filename) :
   in(filename),
   is_closed(false)
 {
   if (!in)
     throw invalid_argument(__PRETTY_FUNCTION__ + string(": error reading file: '" + filename + "'"));
 
-  //read fileversion
-  read<int>();
+  //read fileversion, version 0 files have no sample size field and 2 byte samples,
+  //files before version 2 have no sample kind field and magnitude samples.
+  int version = read<int>();
+  int sample_size = (version >= 1) ? read<int>() : sizeof(unsigned short);
+  int sample_kind = (version >= 2) ? read<int>() : 0;
+
+  if (sample_size != sizeof(T))
+    throw invalid_argument(__PRETTY_FUNCTION__ + string(": sample size in file '" + filename + "' does not match reader."));
+  if (sample_kind != (numeric_limits<T>::is_signed ? 1 : 0))
+    throw invalid_argument(__PRETTY_FUNCTION__ + string(": sample kind (magnitude or I/Q) in file '" + filename + "' does not match reader."));
 }
 
 
-PulseData PulseDataReader::read() {
+template <class T>
+BasicPulseData<T> BasicPulseDataReader<T>::read() {
 
   if (is_closed)
     throw logic_error(__PRETTY_FUNCTION__ + string(": cannot read when reader is closed."));
@@ -36,25 +48,34 @@ PulseData PulseDataReader::read() {
 
   int size = read<int>();
 
-  vector<unsigned short> data(size);  
-  for (int i = 0; i < size; i++)
-    data[i] = read<unsigned short>();
+  vector<T> data(size);
+  in.read(reinterpret_cast<char *>(data.data()), size * sizeof(T));
+  assertNotEndOfFile();
 
-  return PulseData(t, math_vector {x, y, z}, data);
+  return BasicPulseData<T>(t, math_vector {x, y, z}, move(data));
 }
 
 
-bool PulseDataReader::eof() {
+template <class T>
+bool BasicPulseDataReader<T>::eof() {
   in.peek();
   return in.eof();
 }
 
-void PulseDataReader::assertNotEndOfFile() {
+template <class T>
+void BasicPulseDataReader<T>::assertNotEndOfFile() {
   if (in.eof())
     throw logic_error(__PRETTY_FUNCTION__ + string(": Reached unexpected end-of-file."));
 }
 
-void PulseDataReader::close() {
+template <class T>
+void BasicPulseDataReader<T>::close() {
   in.close();
   is_closed = true;
 }
+
+template class BasicPulseDataReader<unsigned short>;
+template class BasicPulseDataReader<unsigned char>;
+template class BasicPulseDataReader<short>;
+
+}
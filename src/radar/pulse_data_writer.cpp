@@ -1,21 +1,27 @@
 #include <iostream>
+#include <limits>
 
 #include <radsim/radar/pulse_data.hpp>
 #include <radsim/radar/pulse_data_writer.hpp>
 
-using namespace radsim;
 using namespace std;
 
-PulseDataWriter::PulseDataWriter(const std::string& filename) :
+namespace radsim {
+
+template <class T>
+BasicPulseDataWriter<T>::BasicPulseDataWriter(const std::string& filename) :
   ofs(filename),
   is_closed(false)
 {
-  //write file version
-  write<int>(0);
+  //write file version, sample size and sample kind
+  write<int>(2);
+  write<int>(sizeof(T));
+  write<int>(numeric_limits<T>::is_signed ? 1 : 0); //signed samples are interleaved I/Q
 }
 
-void PulseDataWriter::write(const PulseData& pulse_data) {
-    
+template <class T>
+void BasicPulseDataWriter<T>::write(const BasicPulseData<T>& pulse_data) {
+
   if (is_closed)
     throw logic_error(__PRETTY_FUNCTION__ + string(": PulseDataWriter cannot write after being closed."));
 
@@ -27,11 +33,17 @@ void PulseDataWriter::write(const PulseData& pulse_data) {
   write<double>(boresight[2]);
 
   write<int>(pulse_data.registry.size());
-  for (unsigned short i : pulse_data.registry)
-    write<unsigned short>(i);
+  ofs.write((const char *) pulse_data.registry.data(), pulse_data.registry.size() * sizeof(T));
 }
 
-void PulseDataWriter::close() {
+template <class T>
+void BasicPulseDataWriter<T>::close() {
   is_closed = true;
   ofs.close();
 }
+
+template class BasicPulseDataWriter<unsigned short>;
+template class BasicPulseDataWriter<unsigned char>;
+template class BasicPulseDataWriter<short>;
+
+}
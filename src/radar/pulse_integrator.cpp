@@ -0,0 +1,169 @@
+#include <math.h>
+
+#include <stdexcept>
+#include <string>
+#include <limits>
+
+#include <radsim/mathematics/constants.hpp>
+#include <radsim/mathematics/mathutils.hpp>
+
+#include <radsim/radar/pulse_integrator.hpp>
+
+using namespace std;
+
+namespace radsim {
+
+IntegratedPulseData::IntegratedPulseData(double t_start_arg, double t_end_arg, math_vector boresight_arg,
+                                         int num_pulses_arg, vector<unsigned int> registry_arg) :
+  t_start( t_start_arg ),
+  t_end( t_end_arg ),
+  boresight( boresight_arg ),
+  num_pulses( num_pulses_arg ),
+  registry( move(registry_arg) )
+{
+}
+
+//s
+double IntegratedPulseData::getStartTime() const {
+  return t_start; //s
+}
+
+//s
+double IntegratedPulseData::getEndTime() const {
+  return t_end; //s
+}
+
+//unit
+math_vector IntegratedPulseData::getBoresight() const {
+  return boresight;
+}
+
+int IntegratedPulseData::getNumPulses() const {
+  return num_pulses;
+}
+
+
+template <class T>
+PulseIntegrator<T>::PulseIntegrator(IntegrationMode mode_arg, double size, size_t pool_capacity) :
+  mode( mode_arg ),
+  num_pulses_max( 0 ),
+  cell_width( 0 ),
+  boresight_sum( {0, 0, 0} ),
+  t_start( 0 ),
+  t_end( 0 ),
+  num_pulses( 0 ),
+  current_cell( -1 ),
+  accumulator_pool( make_shared<RegistryPool<unsigned int>>(pool_capacity) )
+{
+  if (numeric_limits<T>::is_signed)
+    throw logic_error(__PRETTY_FUNCTION__ + string(": non-coherent integration of signed I/Q samples is not supported."));
+
+  switch(mode) {
+    case IntegrationMode::Count:
+      if (size < 1)
+        throw invalid_argument(__PRETTY_FUNCTION__ + string(": must integrate at least one pulse."));
+      if (size != floor(size) || size > numeric_limits<int>::max())
+        throw invalid_argument(__PRETTY_FUNCTION__ + string(": number of pulses must be an integer."));
+      num_pulses_max = size;
+      break;
+    case IntegrationMode::AzimuthCell:
+      if (size <= 0 || size > 2 * pi)
+        throw invalid_argument(__PRETTY_FUNCTION__ + string(": azimuth cell width must be in <0, 2pi]."));
+      cell_width = size; //rad
+      break;
+    default:
+      throw invalid_argument(__PRETTY_FUNCTION__ + string(": not an allowed mode."));
+  }
+}
+
+template <class T>
+int PulseIntegrator<T>::findCell(const math_vector& boresight) const {
+  double theta = atan2(boresight[1], boresight[0]); //rad
+  setRadDefaultRange(theta);
+  return theta / cell_width;
+}
+
+template <class T>
+void PulseIntegrator<T>::complete() {
+  completed.emplace_back(t_start, t_end, math_vector_unit(boresight_sum), num_pulses, move(accumulator));
+  accumulator = vector<unsigned int>();
+  boresight_sum = {0, 0, 0};
+  num_pulses = 0;
+}
+
+template <class T>
+bool PulseIntegrator<T>::add(const BasicPulseData<T>& pulse_data) {
+  const auto& registry = pulse_data.registry;
+
+  if (mode == IntegrationMode::AzimuthCell) {
+    int cell = findCell(pulse_data.getBoresight());
+    if (num_pulses > 0 && cell != current_cell)
+      complete();
+    current_cell = cell;
+  }
+
+  if (num_pulses == 0) {
+    if (accumulator.capacity() == 0)
+      accumulator = accumulator_pool->acquire(); //a recycled registry, or empty
+    accumulator.assign(registry.size(), 0);
+    t_start = pulse_data.getStartTime(); //s
+  }
+  else if (registry.size() != accumulator.size())
+    throw invalid_argument(__PRETTY_FUNCTION__ + string(": all integrated registries must be of equal size."));
+
+  unsigned int * acc = accumulator.data();
+  const T * reg = registry.data();
+  size_t size = registry.size();
+  for (size_t n = 0; n < size; n++)
+    acc[n] += reg[n];
+
+  boresight_sum = boresight_sum + pulse_data.getBoresight();
+  t_end = pulse_data.getStartTime(); //s
+  num_pulses++;
+
+  if (mode == IntegrationMode::Count && num_pulses == num_pulses_max)
+    complete();
+
+  return ready();
+}
+
+template <class T>
+bool PulseIntegrator<T>::ready() const {
+  return !completed.empty();
+}
+
+template <class T>
+IntegratedPulseData PulseIntegrator<T>::getIntegrated() {
+  if (completed.empty())
+    throw logic_error(__PRETTY_FUNCTION__ + string(": no integrated data. Check ready() first."));
+
+  IntegratedPulseData data = move(completed.front());
+  completed.pop_front();
+  return data;
+}
+
+template <class T>
+void PulseIntegrator<T>::recycle(IntegratedPulseData&& data) {
+  accumulator_pool->release( move(data.registry) );
+}
+
+template <class T>
+void PulseIntegrator<T>::flush() {
+  if (num_pulses > 0)
+    complete();
+}
+
+template <class T>
+void PulseIntegrator<T>::reset() {
+  completed.clear();
+  accumulator.clear();
+  boresight_sum = {0, 0, 0};
+  num_pulses = 0;
+  current_cell = -1;
+}
+
+template class PulseIntegrator<unsigned short>;
+template class PulseIntegrator<unsigned char>;
+template class PulseIntegrator<short>; //only to be used by IQRadarInterface, throws on construction
+
+}
@@ -5,11 +5,11 @@
 #include <string>
 #include <complex>
 #include <memory>
+#include <limits>
 
 #include <radsim/mathematics/constants.hpp>
 #include <radsim/mathematics/mathutils.hpp>
 #include <radsim/mathematics/approx_function.hpp>
-#include <radsim/mathematics/fourier.hpp>
 #include <radsim/mathematics/math_vector.hpp>
 
 #include <radsim/radar/radar.hpp>
@@ -25,12 +25,7 @@ namespace radsim {
 
 Radar::Radar(const RadarConfig& config) :
   adc(1, ADCMode::Power, 1),
-  bandpass_filter(0.0),
-  horizontal_beam_shape(0.0),
-  elevation_beam_shape(0.0),
-  emitted_pulse(0.0),
-  filtered_pulse(0.0),
-  sim_pulse(filtered_pulse),
+  clutter_map(2 * pi, 1, 1.0),
   state(0, 0)
 {
   try {
@@ -54,10 +49,17 @@ Radar::Radar(const RadarConfig& config) :
   maximum_receive_time = config.getMaximumReceiveTime(); //s
   horizontal_beamwidth = config.getHorizontalBeamWidth(); //rad
   elevation_beamwidth = config.getElevationBeamWidth(); //rad
-  horizontal_beam_shape = createBeamPattern(config.getHorizontalBeamShape(), horizontal_beamwidth);
-  elevation_beam_shape = createBeamPattern(config.getElevationBeamShape(), elevation_beamwidth);
+  model = RadarModel::get(RadarModelKey(config));
+  sim_pulse = &model->getFilteredPulse();
+  horizontal_beam_shape = BeamShape(config.getHorizontalBeamShape(), horizontal_beamwidth);
+  elevation_beam_shape = BeamShape(config.getElevationBeamShape(), elevation_beamwidth);
   ant_rot_speed = config.getAntRotSpeed(); //rad/s
   init_hor_theta = config.getTheta(); //rad
+  waveform = config.getWaveform();
+  chirp_bandwidth = config.getChirpBandWidth(); //hz
+  clutter_type = config.getClutterType();
+  clutter_sigma0 = config.getClutterSigma0(); //unit
+  clutter_map = ClutterMap(horizontal_beamwidth, 1, config.getClutterShape());
 
   setDerivedParameters();
 
@@ -77,6 +79,7 @@ Radar::Radar(const RadarConfig& config) :
   to_add_clutter = true;
   to_add_target = true;
   use_pdf = true; 
+  to_add_doppler = true;
   to_use_filtered_pulse = true;
   max_sim_distance = 150000; //m
   max_sim_receive_time = (2 * max_sim_distance) / speed_of_light;
@@ -89,7 +92,6 @@ Radar::~Radar()
 //These are parameters that are calculated based on the primary parameters
 void Radar::setDerivedParameters() {
   state.reset(0, init_hor_theta);
-  bandpass_filter = createBandpassFilter(BandpassFilter::Standard, bandwidth); //f(hz) = unit
   carrier_wavelength = speed_of_light / carrier_frequency; //m
   instrumented_range = speed_of_light * maximum_receive_time / 2.0; //m
   unambiguous_range = speed_of_light * prt / 2.0; //m
@@ -97,10 +99,37 @@ void Radar::setDerivedParameters() {
   minimum_range = speed_of_light * minimum_receive_time / 2.0; //m
   setAvgNoise();
   setRangeBins();
-  emitted_pulse = DoubleApproxFunction( {0, pulse_width}, 
-                                        (vector<double>){1, 1}, 0, 0);
-  setFilteredPulse();
-  sim_pulse = filtered_pulse;
+  pulse_bin_span = 4;
+  chirp_rate = 0; //hz/s
+  if (waveform == Waveform::LFM) {
+    pulse_bin_span = ceil(pulse_width / sampling_time) + 4;
+    chirp_rate = chirp_bandwidth / pulse_width; //hz/s
+  }
+  setClutterPower();
+  resetStaticCache();
+}
+
+
+//The clutter patch of a range bin is the beam width times the range bin, at low grazing angle.
+//The texture cache is rebuilt, since it depends on the range bins. 
+void Radar::setClutterPower()
+{
+  clutter_power.assign(num_range_bins, 0);
+  clutter_amplitude.assign(num_range_bins, 0);
+  if (clutter_type != ClutterType::None)
+    for (int n = 0; n < num_range_bins; n++) {
+      double distance = getRange(n); //m
+      double patch_area = distance * horizontal_beamwidth * range_bin; //m2
+      clutter_power[n] = radarEquationPower(distance, clutter_sigma0 * patch_area); //W
+      clutter_amplitude[n] = powerToAmp(clutter_power[n]); //amp
+    }
+
+  int speckle_phases = 4096;
+  speckle_phasors.resize(speckle_phases);
+  for (int k = 0; k < speckle_phases; k++)
+    speckle_phasors[k] = polar(1.0, 2 * pi * k / speckle_phases);
+
+  clutter_map = ClutterMap(horizontal_beamwidth, num_range_bins, clutter_map.getShape(), rng.getSeed());
 }
 
 
@@ -120,63 +149,20 @@ void Radar::setRangeBins()
 }
 
 
-//Sets the shape of the filtered pulse, s_0, based on the shape of the incoming pulse and the bandpass filter. 
-//See technical document: Signal Reception / BandPass filtering of target signals
-void Radar::setFilteredPulse()
-{
-  //Set the shape of the incoming pulse, s,  as an approxfunction
-  const auto& s = emitted_pulse; //func(s) = unit
-    
-  //Fourier transforming the function s(t)-> S(f)
-  double dt = pulse_width * 1e-3; //s
-  int num_frequencies = 1000;
-  double f_min = -3.0 / pulse_width; //hz
-  double f_max =  3.0 / pulse_width; //hz
-  double df = (f_max - f_min) / num_frequencies; //hz
-  vector<double> frequency(num_frequencies); //hz
-  for (int n = 0; n < num_frequencies; n++) 
-    frequency[n] = f_min + df * n; //hz
-    
-  auto S = fourierTransform(s, frequency, dt, 0.0, pulse_width); //func(hz) = unit
-    
-  //modulating S with the bandpass filter
-  vector<complex<double>> HS(num_frequencies); //hz
-  for (int n = 0; n < num_frequencies; n++)
-    HS[n] = S.output(frequency[n]) * bandpass_filter.output(frequency[n]);
-
-  ComplexApproxFunction Modulated(frequency, HS); //func(hz) = unit
-    
-  //Finally, finding the filtered pulse:
-  int num_times = 1000;
-  vector<double> Time(num_times); //s
-  double t_min = -2.0 * pulse_width; //s
-  double t_max = 3.0 * pulse_width; //s
-  dt = (t_max - t_min) / num_times; //s
-  for (int n = 0; n < num_times; n++)
-    Time[n] = t_min + dt * n; //s
-
-  auto filtered_pulse_complex = fourierTransform(Modulated, Time, df, f_min, f_max, true); //func(s) = unit
-  vector<double> value(num_times);
-  for (int n = 0; n < num_times; n++) {
-    value[n] = abs( filtered_pulse_complex.getValueVector()[n] ); //unit
-  }
-  filtered_pulse = DoubleApproxFunction(move(Time), value); //func(s) = unit
-} 
-
 // unit f(hz)
 DoubleApproxFunction Radar::getFilteredPulse() const
 {
-   return filtered_pulse; //unit f(hz)
+   return model->getFilteredPulse(); //unit f(hz)
 }
 
 //func(rad) = unit, on power level
 DoubleApproxFunction Radar::getHorizontalBeamShape() const {
-  return horizontal_beam_shape;
+  return model->getHorizontalBeamShape();
 }
 
 //func(rad) = unit, on power level
 DoubleApproxFunction Radar::getElevationBeamShape() const {
-  return elevation_beam_shape;
+  return model->getElevationBeamShape();
 }
 
 //m
@@ -203,6 +189,10 @@ double Radar::getRangeBin() const
   return range_bin;
 }
 
+int Radar::getNumRangeBins() const {
+  return num_range_bins;
+}
+
 //W
 double Radar::getPeakPower() const
 {
@@ -247,6 +237,11 @@ bool Radar::getUsePdf() const
    return use_pdf;
 }
 
+bool Radar::getToAddDoppler() const
+{
+   return to_add_doppler;
+}
+
 //m
 double Radar::getRange(int bin_index) const {
    return minimum_range + bin_index * range_bin; //m
@@ -271,12 +266,17 @@ void Radar::setUsePdf(bool set) {
    use_pdf = set;
 }
 
+void Radar::setToAddDoppler(bool set) {
+   to_add_doppler = set;
+}
+
 void Radar::setToUseFilteredPulse(bool set) {
   to_use_filtered_pulse = set;
   if (set)
-    sim_pulse = filtered_pulse;
+    sim_pulse = &model->getFilteredPulse();
   else
-    sim_pulse = emitted_pulse;
+    sim_pulse = &model->getEmittedPulse();
+  resetStaticCache();
 }
 
 //W
@@ -294,6 +294,29 @@ double Radar::getPRT() const {
   return prt; //s
 }
 
+//m
+double Radar::getCarrierWavelength() const {
+  return carrier_wavelength; //m
+}
+
+Waveform Radar::getWaveform() const {
+  return waveform;
+}
+
+ClutterType Radar::getClutterType() const {
+  return clutter_type;
+}
+
+//W
+double Radar::getMeanClutterPower(int bin_index) const {
+  return clutter_power[bin_index]; //W
+}
+
+//hz
+double Radar::getChirpBandWidth() const {
+  return chirp_bandwidth; //hz
+}
+
 //s
 double Radar::getDuplexerSwitchTime() const {
   return duplexer_switch_time; //s
@@ -314,6 +337,7 @@ void Radar::setAntRotSpeed(double w)
 //w: rad/s
 {
   ant_rot_speed = w; //rad/s
+  resetStaticCache();
 }
 
 bool Radar::getToUseFilteredPulse() const {
@@ -323,6 +347,19 @@ bool Radar::getToUseFilteredPulse() const {
 void Radar::setRandomParameters(bool custom, int seed_value, double (*Q_custom)(unsigned int *))
 {
   rng = RNG(custom, seed_value, Q_custom);
+  clutter_map.setSeed(rng.getSeed());
+}
+
+void Radar::setRandomParameters(uint64_t seed_value, double (*Q_custom)(uint64_t *))
+{
+  rng = RNG(seed_value, Q_custom);
+  clutter_map.setSeed(rng.getSeed());
+}
+
+void Radar::setRandomSeed(uint64_t seed_value)
+{
+  rng.setSeed(seed_value);
+  clutter_map.setSeed(rng.getSeed());
 }
 
 //s, initial horizontal position of antenna
@@ -336,6 +373,8 @@ double Radar::getInitialHorTheta() const {
 double Radar::noise(double Q) const
 //Q: [0, 1>, input to PDF from random number generator
 {
+   if (Q >= 1) //the default chaos function includes 1
+     Q = 0;
    if (use_pdf)
      return rayleighPDF(avg_noise, Q); //W
    else
@@ -346,6 +385,7 @@ void Radar::setInitialHorTheta(double theta_arg)
 //theta_arg: rad
 {
   init_hor_theta = theta_arg; //rad
+  resetStaticCache();
 }
 
 
@@ -358,6 +398,29 @@ double Radar::radarEquationPower(double distance, double cross_section) const
          ( pow(4 * pi, 3) * pow(distance, 4) );
 }
 
+//Speckle is complex gaussian, e.g. exponentially distributed power with random phase.
+//The speckle phase is taken from a table of speckle_phases phasors.
+void Radar::addClutterSignal(std::vector<double>& Signal_I, std::vector<double>& Signal_Q)
+//Signal: amp
+{
+  const float * texture = clutter_map.getTexture( clutter_map.findCell(state.getTheta()) ); //unit
+  const double * amplitude = clutter_amplitude.data(); //amp
+  for (int n = 0; n < num_range_bins; n++) {
+    if (use_pdf) {
+      double Q = rng.output();
+      if (Q >= 1)
+        Q = 0;
+      double speckle_amplitude = amplitude[n] * sqrt( - texture[n] * log(1 - Q) ); //amp
+      const complex<double>& phasor = speckle_phasors[ (int) (rng.output() * speckle_phasors.size()) % speckle_phasors.size() ];
+      Signal_I[n] += speckle_amplitude * phasor.real(); //amp
+      Signal_Q[n] += speckle_amplitude * phasor.imag(); //amp
+    }
+    else
+      Signal_I[n] += amplitude[n] * sqrt(texture[n]); //amp
+  }
+}
+
+
 //Finding the rangebin in which a signal (left unfiltered) is first received
 //Technical document: Signal Reception / Signal Strength at Sampling Stage
 int Radar::findRangeBin(double ReceiveTime) const {
@@ -396,93 +459,374 @@ void Radar::setTargetSignal(std::vector<double>& TargetSignal_I, std::vector<dou
 {
   int TargetBin = findRangeBin(ReceiveTime);
   int FirstTargetBin = TargetBin - 3;
-  int LastTargetBin  = TargetBin + 4;
+  int LastTargetBin  = TargetBin + pulse_bin_span;
   double Value = powerToAmp(SignalPower); //amp
   for (int n = FirstTargetBin; n <= LastTargetBin; n++)
     if (n >= 0 && n < num_range_bins) {
       //FilteredPulse adjusts the incoming signal due to bandpass filtering. 
       double phase = 2 * pi * rng.output(); //rad
-      double bin_signal = Value * sim_pulse.output( minimum_receive_time + n * sampling_time - ReceiveTime ); //amp, power per range bin, due to filtering
+      double bin_signal = Value * sim_pulse->output( minimum_receive_time + n * sampling_time - ReceiveTime ); //amp, power per range bin, due to filtering
       TargetSignal_I[n] += bin_signal * cos(phase); //amp
       TargetSignal_Q[n] += bin_signal * sin(phase); //amp
     }
 }
 
 
-//In addition to generating a PulseData object, this functions changes the state of the radai simulation,
-//with regards to time, antennaeposition, and storing of signals beyong unambiuous range.     
-PulseData Radar::generatePulseData(const TargetCollection& targets, bool signal_override, double signal_strength)
+//Same as setTargetSignal, but with a common phase for all range bins.
+void Radar::setCoherentTargetSignal(std::vector<double>& TargetSignal_I, std::vector<double>& TargetSignal_Q, double ReceiveTime, double SignalPower, double phase) const
+//TargetSignals: amp
+//ReceiveTime: s
+//SignalPower: W
+//phase: rad
+{
+  int TargetBin = findRangeBin(ReceiveTime);
+  int FirstTargetBin = TargetBin - 3;
+  int LastTargetBin  = TargetBin + pulse_bin_span;
+  double Value = powerToAmp(SignalPower); //amp
+  double Value_I = Value * cos(phase); //amp
+  double Value_Q = Value * sin(phase); //amp
+  for (int n = FirstTargetBin; n <= LastTargetBin; n++)
+    if (n >= 0 && n < num_range_bins) {
+      double t = minimum_receive_time + n * sampling_time - ReceiveTime; //s, time since echo start
+      double bin_gain = sim_pulse->output(t); //unit, due to filtering
+      if (waveform == Waveform::LFM) {
+        double bin_phase = phase + chirpPhase(t); //rad
+        TargetSignal_I[n] += Value * bin_gain * cos(bin_phase); //amp
+        TargetSignal_Q[n] += Value * bin_gain * sin(bin_phase); //amp
+      }
+      else {
+        TargetSignal_I[n] += Value_I * bin_gain; //amp
+        TargetSignal_Q[n] += Value_Q * bin_gain; //amp
+      }
+    }
+}
+
+
+//rad, the LFM sweep is centered on the carrier, from -chirp_bandwidth/2 to chirp_bandwidth/2.
+//Outside the pulse, the phase is held at the pulse edge value.
+double Radar::chirpPhase(double t) const
+//t: s
+{
+  if (waveform != Waveform::LFM)
+    return 0; //rad
+
+  t = fmin(fmax(t, 0), pulse_width) - 0.5 * pulse_width; //s
+  return pi * chirp_rate * t * t; //rad
+}
+
+
+vector<complex<double>> Radar::getPulseReplica() const {
+  int length = round(pulse_width / sampling_time);
+  if (length < 1)
+    length = 1;
+  vector<complex<double>> replica(length);
+  for (int m = 0; m < length; m++)
+    replica[m] = polar(1.0, chirpPhase(m * sampling_time));
+  return replica;
+}
+
+
+//rad, two-way phase of an echo from a target at distance
+double Radar::targetPhase(double distance) const
+//distance: m
+{
+  return - 4 * pi * distance / carrier_wavelength; //rad
+}
+
+
+//Sets the signal contribution from all targets to each range bin, including signals carried 
+//from beyond unambiguous range in previous emission period(s).
+void Radar::setTargetSignals(std::vector<double>& TargetSignal_I, std::vector<double>& TargetSignal_Q, 
+                             const TargetCollection& targets, bool signal_override, double signal_strength, bool coherent)
+//TargetSignals: amp
+//signal_override: if true, target signal is signal_strength at boresight
+//signal_strength: W
+//coherent: if true, the target phase is given by the target range, else random per range bin
+{
+  auto& list_carry = state.getListCarry();
+
+  //looping over signals reflected from beyong unambiguous range in previous emission period(s).
+  auto it = list_carry.begin();
+  while (it != list_carry.end()) {
+    if (it->time < prt) {
+      double offset_gain = offsetGain(it->pos);
+      if (coherent)
+        setCoherentTargetSignal(TargetSignal_I, TargetSignal_Q, it->time, it->power * offset_gain, it->phase);
+      else
+        setTargetSignal(TargetSignal_I, TargetSignal_Q, it->time, it->power * offset_gain);
+      it = list_carry.erase(it);
+    }
+    else {
+      it->time -= prt;
+      it++;
+    }
+  }
+
+  //Then handling new cases:
+  addTargetEchoes(TargetSignal_I, TargetSignal_Q, targets, signal_override, signal_strength, coherent);
+  addTargetEchoes(TargetSignal_I, TargetSignal_Q, static_far_targets, false, 0, coherent);
+  if (!static_targets.empty())
+    addStaticTargetSignals(TargetSignal_I, TargetSignal_Q, coherent);
+}
+
+
+//Sets the signal contribution from the targets to each range bin. Echoes from beyond unambiguous range
+//are stored in the state, to be received in the following emission period(s).
+void Radar::addTargetEchoes(std::vector<double>& TargetSignal_I, std::vector<double>& TargetSignal_Q, 
+                            const TargetCollection& targets, bool signal_override, double signal_strength, bool coherent)
+//TargetSignals: amp
 //signal_override: if true, target signal is signal_strength at boresight
 //signal_strength: W
 {
-  //transfer data from State:
   double state_time = state.getTime(); //s, the time when pulse emission begins. 
   auto& list_carry = state.getListCarry();
 
-  //Calculations from target(s)
-  vector<double> target_signal_I(num_range_bins, 0); //amp
-  vector<double> target_signal_Q(num_range_bins, 0); //amp
-
-  if (to_add_target) {
-
-    //looping over signals reflected from beyong unambiguous range in previous emission period(s).
-    auto it = list_carry.begin();
-    while (it != list_carry.end()) {
-      if (it->time < prt) {
-        double offset_gain = offsetGain(it->pos);
-        setTargetSignal(target_signal_I, target_signal_Q, it->time, it->power * offset_gain);
-        it = list_carry.erase(it);
-      }
-      else {
-        it->time -= prt;
-        it++;
+  for (const Target& target : targets) {
+    double rcs = target.getRCS();
+    math_vector pos = target.getPosition(state_time);
+    double received_boresight_power; //W, received power if target was in boresight
+    double target_distance = math_vector_length(pos); //m
+
+    if (signal_override)
+      received_boresight_power = signal_strength; //W
+    else
+      received_boresight_power = radarEquationPower(target_distance, rcs); //W
+
+    double offset_gain = offsetGain(pos); //unit
+    double signal_power = offset_gain * received_boresight_power; //W
+    double receive_time = getTargetReceiveTime(target_distance); //s
+    double phase = 0; //rad
+    if (coherent)
+      phase = targetPhase( to_add_doppler ? target_distance : math_vector_length(target.getPosition(0)) ); //rad
+
+    if (receive_time > prt) {
+      if (receive_time > prt && receive_time <= max_sim_receive_time)
+        list_carry.emplace_back(receive_time - prt, signal_power, pos, phase);
+    }
+    else if (coherent)
+      setCoherentTargetSignal(TargetSignal_I, TargetSignal_Q, receive_time, signal_power * offset_gain, phase);
+    else 
+      setTargetSignal(TargetSignal_I, TargetSignal_Q, receive_time, signal_power * offset_gain);
+  }
+}
+
+
+//Same range bins and amplitudes as setTargetSignal and setCoherentTargetSignal, per static target. 
+//Targets out of the beam give no echoes.
+vector<StaticEcho> Radar::findStaticEchoes() const {
+  vector<StaticEcho> echoes;
+  for (const Target& target : static_targets) {
+    math_vector pos = target.getPosition(0);
+    double target_distance = math_vector_length(pos); //m
+    double offset_gain = offsetGain(pos); //unit
+    if (offset_gain <= 0)
+      continue;
+
+    double signal_power = offset_gain * offset_gain * radarEquationPower(target_distance, target.getRCS()); //W
+    double receive_time = getTargetReceiveTime(target_distance); //s
+    double phase = targetPhase(target_distance); //rad
+    double Value = powerToAmp(signal_power); //amp
+
+    int TargetBin = findRangeBin(receive_time);
+    for (int n = TargetBin - 3; n <= TargetBin + pulse_bin_span; n++)
+      if (n >= 0 && n < num_range_bins) {
+        double t = minimum_receive_time + n * sampling_time - receive_time; //s, time since echo start
+        double bin_signal = Value * sim_pulse->output(t); //amp
+        echoes.emplace_back(n, bin_signal, polar(bin_signal, phase + chirpPhase(t)));
       }
+  }
+  return echoes;
+}
+
+
+//The echoes are computed the first time the antenna visits a pulse slot. The non-coherent echoes
+//are given a new random phase per pulse, as in setTargetSignal.
+void Radar::addStaticTargetSignals(std::vector<double>& TargetSignal_I, std::vector<double>& TargetSignal_Q, bool coherent)
+//TargetSignals: amp
+{
+  int slot = static_cache.findSlot(state.getTheta());
+  if (!static_cache.isCached(slot))
+    static_cache.setEchoes(slot, findStaticEchoes());
+
+  for (const StaticEcho& echo : static_cache.getEchoes(slot)) {
+    if (coherent) {
+      TargetSignal_I[echo.bin] += echo.phasor.real(); //amp
+      TargetSignal_Q[echo.bin] += echo.phasor.imag(); //amp
+    }
+    else {
+      double phase = 2 * pi * rng.output(); //rad
+      TargetSignal_I[echo.bin] += echo.amplitude * cos(phase); //amp
+      TargetSignal_Q[echo.bin] += echo.amplitude * sin(phase); //amp
     }
+  }
+}
 
-    //Then handling new cases:
-    for (const Target& target : targets) {
-      double rcs = target.getRCS();
-      math_vector pos = target.getPosition(state_time);
-      double received_boresight_power; //W, received power if target was in boresight
-      double target_distance = math_vector_length(pos); //m
 
-      if (signal_override)
-        received_boresight_power = signal_strength; //W
-      else
-        received_boresight_power = radarEquationPower(target_distance, rcs); //W
+void Radar::resetStaticCache() {
+  static_cache = StaticSceneCache(prt * ant_rot_speed, init_hor_theta);
+}
 
-      double offset_gain = offsetGain(pos); //unit
-      double signal_power = offset_gain * received_boresight_power; //W
-      double receive_time = getTargetReceiveTime(target_distance); //s
 
-      if (receive_time > prt) {
-        if (receive_time > prt && receive_time <= max_sim_receive_time)
-          list_carry.emplace_back(receive_time - prt, signal_power, pos);
-      }
-      else 
-        setTargetSignal(target_signal_I, target_signal_Q, receive_time, signal_power * offset_gain);
+//Targets with echoes from beyond unambiguous range are carried between pulses, and are not cached.
+void Radar::setStaticTargets(TargetCollection targets) {
+  static_targets.clear();
+  static_far_targets.clear();
+  for (Target& target : targets) {
+    if (getTargetReceiveTime(math_vector_length(target.getPosition(0))) > prt) {
+      target.setPosition(target.getPosition(0));
+      static_far_targets.push_back(move(target));
     }
+    else
+      static_targets.push_back(move(target));
   }
+  resetStaticCache();
+}
+
+
+void Radar::clearStaticTargets() {
+  setStaticTargets({});
+}
+
+
+size_t Radar::getNumStaticTargets() const {
+  return static_targets.size() + static_far_targets.size();
+}
+
+
+int Radar::getNumStaticCacheSlots() const {
+  return static_cache.getNumSlots();
+}
+
+
+int Radar::getNumCachedStaticSlots() const {
+  return static_cache.getNumCachedSlots();
+}
+
+
+//In addition to generating a PulseData object, this functions changes the state of the radai simulation,
+//with regards to time, antennaeposition, and storing of signals beyong unambiuous range.     
+template <class T>
+BasicPulseData<T> Radar::generatePulseData(const TargetCollection& targets, bool signal_override, double signal_strength,
+                                           vector<T> registry_buffer)
+//signal_override: if true, target signal is signal_strength at boresight
+//signal_strength: W
+{
+  checkSampleType<T>();
+
+  //transfer data from State:
+  double state_time = state.getTime(); //s, the time when pulse emission begins. 
+
+  //Calculations from target(s)
+  signal_I.assign(num_range_bins, 0); //amp
+  signal_Q.assign(num_range_bins, 0); //amp
+
+  if (to_add_target)
+    setTargetSignals(signal_I, signal_Q, targets, signal_override, signal_strength, false);
+
+  if (to_add_clutter && clutter_type != ClutterType::None)
+    addClutterSignal(signal_I, signal_Q);
 
   //Final Assembly: combination of target and noise
-  vector<unsigned short> new_registry(num_range_bins);
+  vector<T> new_registry = move(registry_buffer);
+  new_registry.resize(num_range_bins); //every sample is set below
   for (int n = 0; n < num_range_bins; n++)
   {
     double noise_amplitude = 0;
     if (to_add_noise)
       noise_amplitude = powerToAmp(noise( rng.output()  )); //amp
 
-    double amp_I = noise_amplitude + target_signal_I[n]; //amp
-    double amp_Q = target_signal_Q[n]; //amp
+    double amp_I = noise_amplitude + signal_I[n]; //amp
+    double amp_Q = signal_Q[n]; //amp
     double bin_power = amp_I * amp_I + amp_Q * amp_Q; //W
     new_registry[n] = adc.convertSignal(bin_power); //unit
   }
 
-  PulseData pulse_data(state_time, state.getBoresight(), move(new_registry));
+  BasicPulseData<T> pulse_data(state_time, state.getBoresight(), move(new_registry));
   state.incrementParams(prt, prt * ant_rot_speed);
   return pulse_data;
 }
 
+template PulseData Radar::generatePulseData(const TargetCollection& targets, bool signal_override, double signal_strength,
+                                            vector<unsigned short> registry_buffer);
+template BytePulseData Radar::generatePulseData(const TargetCollection& targets, bool signal_override, double signal_strength,
+                                                vector<unsigned char> registry_buffer);
+
+
+//Same as generatePulseData, but the registry holds the interleaved I and Q samples of each range bin.
+IQPulseData Radar::generateIQPulseData(const TargetCollection& targets, bool signal_override, double signal_strength,
+                                       vector<short> registry_buffer)
+//signal_override: if true, target signal is signal_strength at boresight
+//signal_strength: W
+{
+  checkSampleType<short>();
+
+  double state_time = state.getTime(); //s, the time when pulse emission begins. 
+
+  signal_I.assign(num_range_bins, 0); //amp
+  signal_Q.assign(num_range_bins, 0); //amp
+
+  if (to_add_target)
+    setTargetSignals(signal_I, signal_Q, targets, signal_override, signal_strength, true);
+
+  if (to_add_clutter && clutter_type != ClutterType::None)
+    addClutterSignal(signal_I, signal_Q);
+
+  //Final Assembly: combination of target and noise with random phase
+  vector<short> new_registry = move(registry_buffer);
+  new_registry.resize(2 * num_range_bins); //every sample is set below
+  for (int n = 0; n < num_range_bins; n++)
+  {
+    double amp_I = signal_I[n]; //amp
+    double amp_Q = signal_Q[n]; //amp
+    if (to_add_noise) {
+      double noise_amplitude = powerToAmp(noise( rng.output() )); //amp
+      double phase = 0; //rad
+      if (use_pdf)
+        phase = 2 * pi * rng.output(); //rad
+      amp_I += noise_amplitude * cos(phase); //amp
+      amp_Q += noise_amplitude * sin(phase); //amp
+    }
+    new_registry[2 * n]     = adc.convertAmplitude(amp_I); //unit
+    new_registry[2 * n + 1] = adc.convertAmplitude(amp_Q); //unit
+  }
+
+  IQPulseData pulse_data(state_time, state.getBoresight(), move(new_registry));
+  state.incrementParams(prt, prt * ant_rot_speed);
+  return pulse_data;
+}
+
+template <class T>
+BasicPulseData<T> Radar::generate(const TargetCollection& targets, bool signal_override, double signal_strength,
+                                  vector<T> registry_buffer) {
+  return generatePulseData<T>(targets, signal_override, signal_strength, move(registry_buffer));
+}
+
+template <>
+IQPulseData Radar::generate<short>(const TargetCollection& targets, bool signal_override, double signal_strength,
+                                   vector<short> registry_buffer) {
+  return generateIQPulseData(targets, signal_override, signal_strength, move(registry_buffer));
+}
+
+template PulseData Radar::generate(const TargetCollection& targets, bool signal_override, double signal_strength,
+                                   vector<unsigned short> registry_buffer);
+template BytePulseData Radar::generate(const TargetCollection& targets, bool signal_override, double signal_strength,
+                                       vector<unsigned char> registry_buffer);
+
+
+template <class T>
+void Radar::checkSampleType() const {
+  int max_level = adc.getNumLevels() - 1;
+  if (numeric_limits<T>::is_signed)
+    max_level = adc.getNumLevels() / 2 - 1; //I/Q samples
+  if (max_level > numeric_limits<T>::max())
+    throw invalid_argument(__PRETTY_FUNCTION__ + string(": ADC resolution too high for the sample type of the registry."));
+}
+
+template void Radar::checkSampleType<unsigned short>() const;
+template void Radar::checkSampleType<unsigned char>() const;
+template void Radar::checkSampleType<short>() const;
+
+
 void Radar::reset(double t)
 //t: s 
 {
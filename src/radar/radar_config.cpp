@@ -52,6 +52,13 @@ void RadarConfig::assertParametersSet() const {
 
    if (sampling_time > pulse_width)
      throw logic_error(__PRETTY_FUNCTION__ + string(": Samplingtime must be set to less or equal to pulse_width."));
+
+   if (waveform == Waveform::LFM) {
+     if (chirp_bandwidth <= 0)
+       throw logic_error(__PRETTY_FUNCTION__ + string(": LFM waveform requires a positive chirp bandwidth."));
+     if (chirp_bandwidth * getSamplingTime() > 1)
+       throw logic_error(__PRETTY_FUNCTION__ + string(": chirp bandwidth must be less or equal to the sampling rate."));
+   }
 }
 
 void RadarConfig::setPeakPower(double power)
@@ -152,6 +159,36 @@ void RadarConfig::setAzimuth(double azimuth)
   theta_set = true;
 }
 
+void RadarConfig::setWaveform(Waveform waveform_arg)
+{
+  waveform = waveform_arg;
+}
+
+void RadarConfig::setChirpBandWidth(double bandWidth)
+//bandWidth: Mhz
+{
+  chirp_bandwidth = bandWidth * 1e6; //hz
+}
+
+void RadarConfig::setClutterType(ClutterType type)
+{
+  clutter_type = type;
+}
+
+void RadarConfig::setClutterSigma0(double sigma0)
+//sigma0: db
+{
+  clutter_sigma0 = pow(10, 0.1 * sigma0); //unit
+}
+
+void RadarConfig::setClutterShape(double shape)
+//shape: unit
+{
+  if (shape <= 0)
+    throw invalid_argument(__PRETTY_FUNCTION__ + string(": clutter shape parameter must be positive."));
+  clutter_shape = shape; //unit
+}
+
 void RadarConfig::setADCMode(ADCMode adcMode)
 {
   adc_converter_mode = adcMode;
@@ -273,6 +310,40 @@ double RadarConfig::getElevationBeamWidth() const {
   return elevation_beamwidth; //rad
 }
 
+Waveform RadarConfig::getWaveform() const {
+  return waveform;
+}
+
+//hz
+double RadarConfig::getChirpBandWidth() const {
+  return chirp_bandwidth; //hz
+}
+
+ClutterType RadarConfig::getClutterType() const {
+  return clutter_type;
+}
+
+//unit, defaults: -40 db for sea (low grazing angle, moderate sea state), -20 db for land
+double RadarConfig::getClutterSigma0() const {
+  if (clutter_sigma0 >= 0)
+    return clutter_sigma0; //unit
+  switch(clutter_type) {
+    case ClutterType::Sea:  return 1e-4; //unit
+    case ClutterType::Land: return 1e-2; //unit
+    default:                return 0;
+  }
+}
+
+//unit, defaults: spiky sea clutter, close to Rayleigh land clutter
+double RadarConfig::getClutterShape() const {
+  if (clutter_shape > 0)
+    return clutter_shape; //unit
+  switch(clutter_type) {
+    case ClutterType::Land: return 5.0; //unit
+    default:                return 1.0; //unit
+  }
+}
+
 ADCMode RadarConfig::getADCMode() const {
   return adc_converter_mode;
 }
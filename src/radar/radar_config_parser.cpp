@@ -1,3 +1,5 @@
+#include <math.h>
+
 #include <iostream>
 #include <sstream>
 #include <fstream>
@@ -31,6 +33,11 @@ namespace {
   const string ADCMODE = "ADCMode";
   const string ADCMIN2NOISE = "ADCMin2Noise";
   const string ADCMAX2NOISE = "ADCMax2Noise";
+  const string WAVEFORM = "Waveform";
+  const string CHIRPBANDWIDTH = "ChirpBandWidth";
+  const string CLUTTERTYPE = "ClutterType";
+  const string CLUTTERSIGMA0 = "ClutterSigma0";
+  const string CLUTTERSHAPE = "ClutterShape";
 
   //map between keyword and RadarConfigType
   map<string, RadarConfigType> createKeyTypes() {
@@ -52,7 +59,12 @@ namespace {
       {ADCRESOLUTION,    RadarConfigType::integer},
       {ADCMODE,          RadarConfigType::fstring},
       {ADCMIN2NOISE,     RadarConfigType::fdouble},
-      {ADCMAX2NOISE,     RadarConfigType::fdouble}
+      {ADCMAX2NOISE,     RadarConfigType::fdouble},
+      {WAVEFORM,         RadarConfigType::fstring},
+      {CHIRPBANDWIDTH,   RadarConfigType::fdouble},
+      {CLUTTERTYPE,      RadarConfigType::fstring},
+      {CLUTTERSIGMA0,    RadarConfigType::fdouble},
+      {CLUTTERSHAPE,     RadarConfigType::fdouble}
       };
     return type_dict;
   }
@@ -105,6 +117,27 @@ void RadarConfigParser::setKeyordParams(RadarConfig& config, std::string keyword
   }
   else if (keyword == ADCMIN2NOISE) config.setADCMin2Noise(value.dval);
   else if (keyword == ADCMAX2NOISE) config.setADCMax2Noise(value.dval);
+  else if (keyword == WAVEFORM) {
+    if (value.sval == "Rectangular")
+      config.setWaveform( Waveform::Rectangular );
+    else if (value.sval == "LFM")
+      config.setWaveform( Waveform::LFM );
+    else
+      throw invalid_argument(__PRETTY_FUNCTION__ + string(": Unrecognized Waveform: '") + value.sval + string("'."));
+  }
+  else if (keyword == CHIRPBANDWIDTH) config.setChirpBandWidth(value.dval);
+  else if (keyword == CLUTTERTYPE) {
+    if (value.sval == "None")
+      config.setClutterType( ClutterType::None );
+    else if (value.sval == "Sea")
+      config.setClutterType( ClutterType::Sea );
+    else if (value.sval == "Land")
+      config.setClutterType( ClutterType::Land );
+    else
+      throw invalid_argument(__PRETTY_FUNCTION__ + string(": Unrecognized ClutterType: '") + value.sval + string("'."));
+  }
+  else if (keyword == CLUTTERSIGMA0) config.setClutterSigma0(value.dval);
+  else if (keyword == CLUTTERSHAPE)  config.setClutterShape(value.dval);
 }
 
 
@@ -159,6 +192,24 @@ void RadarConfigParser::parseKeyword(RadarConfig& config, set<string>& set_keys,
 }
 
 
+void RadarConfigParser::setKeyword(RadarConfig& config, const string& keyword, double value) const {
+  RadarConfigValue config_value;
+  switch(getKeywordType(keyword)) {
+    case RadarConfigType::fdouble: 
+      config_value.dval = value; 
+      break;
+    case RadarConfigType::integer: 
+      if (value != round(value))
+        throw invalid_argument(__PRETTY_FUNCTION__ + string(": keyword '") + keyword + string("' must have an integer value."));
+      config_value.ival = value; 
+      break;
+    default: 
+      throw invalid_argument(__PRETTY_FUNCTION__ + string(": keyword '") + keyword + string("' is not numeric."));
+  }
+  setKeyordParams(config, keyword, config_value);
+}
+
+
 RadarConfig RadarConfigParser::parseStream(std::istream& in) const {
   string line;
 
@@ -1,90 +1,163 @@
 #include <stdexcept>
+#include <chrono>
 
+#include <radsim/radar/pulse_integrator.hpp>
 #include <radsim/radar/radar_data_queue.hpp>
 
 using namespace std;
 
 namespace radsim {
 
-DataQueueNode::DataQueueNode(PulseData data_arg) :
-  data( move(data_arg) ),
-  next( NULL )
-{
-}
+namespace {
 
+  size_t roundUpToPowerOfTwo(size_t n) {
+    size_t power = 1;
+    while (power < n)
+      power *= 2;
+    return power;
+  }
 
-RadarDataQueue::RadarDataQueue() :
-  head(NULL),
-  tail(NULL),
-  pushed_initial(false),
-  num_nodes( 0 ),
-  num_nodes_main(0)
-{}
+}
 
 
-RadarDataQueue::~RadarDataQueue() {
-  empty();
+template <class Data>
+BasicRadarDataQueue<Data>::BasicRadarDataQueue(size_t capacity) :
+  slots( roundUpToPowerOfTwo(capacity) ),
+  mask( slots.size() - 1 ),
+  head( 0 ),
+  cached_tail( 0 ),
+  tail( 0 ),
+  cached_head( 0 ),
+  num_overruns( 0 ),
+  consumer_sleeping( false ),
+  spin_limit( 1024 )
+{
+  if (capacity == 0)
+    throw invalid_argument(__PRETTY_FUNCTION__ + string(": capacity must be positive."));
 }
 
-void RadarDataQueue::pop__() {
-  num_nodes--;
-  num_nodes_main--;
-  DataQueueNode * ptr = head;
-  head = head->next;
-  delete ptr;
-}
 
-//One ABOLUTELY has to check with size() before using this function!!!
-PulseData RadarDataQueue::pop() {
-  if (num_nodes_main <= 1)
-    throw logic_error(__PRETTY_FUNCTION__ + string(": tried to access empty queue."));    
+//The head is only reloaded from the consumer when the ring looks full from the cached value.
+template <class Data>
+bool BasicRadarDataQueue<Data>::push( Data&& data ) {
+  size_t t = tail.load(memory_order_relaxed);
+  if (t - cached_head == slots.size()) {
+    cached_head = head.load(memory_order_acquire);
+    if (t - cached_head == slots.size()) {
+      num_overruns.fetch_add(1, memory_order_relaxed);
+      return false;
+    }
+  }
 
-  auto data = move(head->data);
-  pop__();
-  return data;
+  slots[t & mask].emplace( move(data) );
+  tail.store(t + 1, memory_order_release);
+  notifyConsumer();
+  return true;
 }
 
 
-bool RadarDataQueue::isEmpty() {
-  return (head == NULL);
+//The fence pairs with the one in wait: either the producer sees the consumer asleep, or the
+//consumer sees the new tail before it sleeps.
+template <class Data>
+void BasicRadarDataQueue<Data>::notifyConsumer() {
+  atomic_thread_fence(memory_order_seq_cst);
+  if (consumer_sleeping.load(memory_order_relaxed)) {
+    lock_guard<mutex> lock(wait_mutex);
+    wait_condition.notify_one();
+  }
 }
 
-void RadarDataQueue::empty() {
-  while (head)
-    pop__();
-  pushed_initial = false;
+
+template <class Data>
+Data BasicRadarDataQueue<Data>::pop() {
+  size_t h = head.load(memory_order_relaxed);
+  if (h == cached_tail) {
+    cached_tail = tail.load(memory_order_acquire);
+    if (h == cached_tail)
+      throw logic_error(__PRETTY_FUNCTION__ + string(": tried to access empty queue."));
+  }
+
+  optional<Data>& slot = slots[h & mask];
+  Data data = move(*slot);
+  slot.reset();
+  head.store(h + 1, memory_order_release);
+  return data;
 }
 
-size_t RadarDataQueue::size() {
-  num_nodes_main = num_nodes.load();
-  return num_nodes_main;
+
+template <class Data>
+size_t BasicRadarDataQueue<Data>::popInto(span<Data> batch) {
+  size_t h = head.load(memory_order_relaxed);
+  cached_tail = tail.load(memory_order_acquire);
+  size_t num = min(cached_tail - h, batch.size());
+
+  for (size_t n = 0; n < num; n++) {
+    optional<Data>& slot = slots[(h + n) & mask];
+    batch[n] = move(*slot);
+    slot.reset();
+  }
+  head.store(h + num, memory_order_release);
+  return num;
 }
 
 
-void RadarDataQueue::pushInitial( PulseData data ) {
+template <class Data>
+bool BasicRadarDataQueue<Data>::wait(double timeout)
+//timeout: s
+{
+  size_t h = head.load(memory_order_relaxed);
+  for (size_t n = 0; n < spin_limit; n++)
+    if (tail.load(memory_order_acquire) != h) {
+      spin_limit = min(2 * spin_limit, max_spin_limit);
+      return true;
+    }
+  spin_limit = max(spin_limit / 2, min_spin_limit);
+
+  unique_lock<mutex> lock(wait_mutex);
+  consumer_sleeping.store(true, memory_order_relaxed);
+  atomic_thread_fence(memory_order_seq_cst);
+  bool ready = wait_condition.wait_for(lock, chrono::duration<double>(timeout),
+                                       [&] { return tail.load(memory_order_acquire) != h; });
+  consumer_sleeping.store(false, memory_order_relaxed);
+  return ready;
+}
 
-  if (pushed_initial)
-    throw logic_error(__PRETTY_FUNCTION__ + string(": this function can only be called once."));
 
-  pushed_initial = true;
+template <class Data>
+bool BasicRadarDataQueue<Data>::isEmpty() const {
+  return size() == 0;
+}
 
-  DataQueueNode * node = new DataQueueNode( move(data) );
-  head = node;
-  tail = node;
-  num_nodes++;
+template <class Data>
+size_t BasicRadarDataQueue<Data>::size() const {
+  size_t h = head.load(memory_order_acquire);
+  size_t t = tail.load(memory_order_acquire);
+  return t - h;
 }
 
+template <class Data>
+void BasicRadarDataQueue<Data>::empty() {
+  for (auto& slot : slots)
+    slot.reset();
+  head.store(0);
+  tail.store(0);
+  cached_head = 0;
+  cached_tail = 0;
+}
 
-void RadarDataQueue::push( PulseData data ) {
+template <class Data>
+size_t BasicRadarDataQueue<Data>::getCapacity() const {
+  return slots.size();
+}
 
-  if (pushed_initial) {
-    DataQueueNode * node = new DataQueueNode( move(data) );
-    tail->next = node;
-    tail = node;
-    num_nodes++;
-  }
-  else
-    throw logic_error(__PRETTY_FUNCTION__ + string(": 'push_initial' must be called first."));
+template <class Data>
+size_t BasicRadarDataQueue<Data>::getNumOverruns() const {
+  return num_overruns.load(memory_order_relaxed);
 }
 
+template class BasicRadarDataQueue<PulseData>;
+template class BasicRadarDataQueue<BytePulseData>;
+template class BasicRadarDataQueue<IQPulseData>;
+template class BasicRadarDataQueue<IntegratedPulseData>;
+
 }
@@ -11,8 +11,30 @@ using namespace radsim;
 
 namespace {
 
+  //Queues the pulse, or if integrator is set, queues the record when integration is complete.
+  //If the processing has fallen behind and the queue is full, the data is dropped as an overrun.
+  //Registries that are not queued go straight back to the pool.
+  template <class T>
+  void queuePulse(BasicPulseData<T> pulse_data,
+                  BasicRadarDataQueue<BasicPulseData<T>>& queue,
+                  PulseIntegrator<T> * integrator,
+                  BasicRadarDataQueue<IntegratedPulseData>& integrated_queue,
+                  RegistryPool<T>& registry_pool) {
+    if (integrator) {
+      if (integrator->add(pulse_data))
+        integrated_queue.push( integrator->getIntegrated() );
+      registry_pool.release( move(pulse_data.registry) );
+    }
+    else if (!queue.push( move(pulse_data) ))
+      registry_pool.release( move(pulse_data.registry) );
+  }
+
+  template <class T>
   void simulationRunner(Radar& radar,
-                        RadarDataQueue& queue,
+                        BasicRadarDataQueue<BasicPulseData<T>>& queue,
+                        PulseIntegrator<T> * integrator,
+                        BasicRadarDataQueue<IntegratedPulseData>& integrated_queue,
+                        RegistryPool<T>& registry_pool,
                         const TargetCollection& targets,
                         double time_step, 
                         atomic<double>& sim_time_atomic, 
@@ -21,11 +43,22 @@ namespace {
                         bool signal_override, 
                         double signal_strength,
                         bool initiated,
-                        bool statistics) {
+                        bool statistics,
+                        double pacing_slack) {
 
     if (!initiated) {
       radar.reset(0);  //sim_time reset to zero
-      queue.pushInitial( radar.generatePulseData(targets, signal_override, signal_strength) );
+      if (integrator) {
+        while (!integrator->ready()) {
+          BasicPulseData<T> pulse_data = radar.generate<T>(targets, signal_override, signal_strength, registry_pool.acquire());
+          integrator->add(pulse_data);
+          registry_pool.release( move(pulse_data.registry) );
+        }
+        integrated_queue.push( integrator->getIntegrated() );
+      }
+      else
+        queuePulse( radar.generate<T>(targets, signal_override, signal_strength, registry_pool.acquire()),
+                    queue, integrator, integrated_queue, registry_pool );
       initiated = true;
     }
 
@@ -34,7 +67,7 @@ namespace {
     sim_time_atomic.store( start_time ); //s
     allow_send_data.store(true);  
 
-    double work_time = 0; //s, The time the thread has worked without busy-wait
+    double work_time = 0; //s, The time the thread has worked without waiting
     Timer timer;
     double current_time = 0;
 
@@ -43,7 +76,8 @@ namespace {
       double period_start = timer.elapsed(); //s
 
       do {
-        queue.push( radar.generatePulseData(targets, signal_override, signal_strength) );
+        queuePulse( radar.generate<T>(targets, signal_override, signal_strength, registry_pool.acquire()), 
+                    queue, integrator, integrated_queue, registry_pool );
       } while (radar.getCurrentTime() < sim_check );
 
       current_time = radar.getCurrentTime(); //s  
@@ -51,10 +85,7 @@ namespace {
 
       work_time += (timer.elapsed() - period_start);
 
-      double time_status = timer.elapsed() + start_time;
-      while (time_status < radar.getCurrentTime()) {
-        time_status = timer.elapsed() + start_time;
-      } //busy-wait
+      timer.sleepUntil(radar.getCurrentTime() - start_time, pacing_slack);
 
       sim_check += time_step; //s
     }
@@ -73,7 +104,8 @@ namespace {
 namespace radsim {
 
 
-RadarInterface::RadarInterface(const RadarConfig& config, TargetCollection target_collection_arg, double dt) :
+template <class T>
+BasicRadarInterface<T>::BasicRadarInterface(const RadarConfig& config, TargetCollection target_collection_arg, double dt) :
   radar( config ),
   target_collection( move(target_collection_arg) ),
   sim_thread(NULL),
@@ -82,19 +114,28 @@ RadarInterface::RadarInterface(const RadarConfig& config, TargetCollection targe
   statistics(false),
   initiated(false),
   time_step(dt),
+  pacing_slack(Timer::default_slack),
   sim_time(0),
-  queue_size(0)
+  queue_size(0),
+  integrated_queue_size(0),
+  registry_pool( make_shared<RegistryPool<T>>(queue.getCapacity()) )
 {
+  radar.checkSampleType<T>();
+
   min_range = radar.getMinimumRange(); //m
   range_bin = radar.getRangeBin(); //m
+  num_range_bins = radar.getNumRangeBins();
+  prt = radar.getPRT(); //s
 }
 
-RadarInterface::~RadarInterface() {
+template <class T>
+BasicRadarInterface<T>::~BasicRadarInterface() {
   stop();
 }
 
 
-void RadarInterface::setStatistics(bool set) {
+template <class T>
+void BasicRadarInterface<T>::setStatistics(bool set) {
   if (sim_thread)
     throw logic_error(__PRETTY_FUNCTION__ + string(": cannot set Statistics when simulation thread is running."));
 
@@ -102,7 +143,8 @@ void RadarInterface::setStatistics(bool set) {
 }
 
 
-void RadarInterface::setAddNoise(bool set) 
+template <class T>
+void BasicRadarInterface<T>::setAddNoise(bool set) 
 {
   if (sim_thread)
     throw logic_error(__PRETTY_FUNCTION__ + string(": cannot set radar parameters when simulation thread is running."));
@@ -111,15 +153,52 @@ void RadarInterface::setAddNoise(bool set)
 }
 
 
-void RadarInterface::start(bool signal_override, double signal_strength) {
+template <class T>
+void BasicRadarInterface<T>::setPacingSlack(double slack)
+//slack: s
+{
+  if (sim_thread)
+    throw logic_error(__PRETTY_FUNCTION__ + string(": cannot set pacing when simulation thread is running."));
+  if (slack < 0)
+    throw invalid_argument(__PRETTY_FUNCTION__ + string(": slack must be non-negative."));
+
+  pacing_slack = slack;
+}
+
+
+template <class T>
+void BasicRadarInterface<T>::setIntegration(IntegrationMode mode, double size)
+//size: number of pulses, or rad
+{
+  if (initiated)
+    throw logic_error(__PRETTY_FUNCTION__ + string(": cannot set integration after simulation start without reset."));
+
+  integrator.reset( new PulseIntegrator<T>(mode, size, integrated_queue.getCapacity()) );
+}
+
+
+template <class T>
+void BasicRadarInterface<T>::clearIntegration()
+{
+  if (initiated)
+    throw logic_error(__PRETTY_FUNCTION__ + string(": cannot clear integration after simulation start without reset."));
+
+  integrator.reset();
+}
+
+
+template <class T>
+void BasicRadarInterface<T>::start(bool signal_override, double signal_strength) {
 
   if (sim_thread)
     throw logic_error(__PRETTY_FUNCTION__ + string(": cannot restart simulator without stopping first."));
 
   on.store(true);
 
-  sim_thread = new thread(simulationRunner, 
+  sim_thread = new thread(simulationRunner<T>, 
                           ref(radar), ref(queue), 
+                          integrator.get(), ref(integrated_queue), 
+                          ref(*registry_pool), 
                           ref(target_collection), 
                           time_step, 
                           ref(sim_time), 
@@ -128,7 +207,8 @@ void RadarInterface::start(bool signal_override, double signal_strength) {
                           signal_override, 
                           signal_strength, 
                           initiated,
-                          statistics);
+                          statistics,
+                          pacing_slack);
 
   initiated = true;
   
@@ -136,24 +216,27 @@ void RadarInterface::start(bool signal_override, double signal_strength) {
 
 
 //s
-double RadarInterface::getSimTime() const {
+template <class T>
+double BasicRadarInterface<T>::getSimTime() const {
   return sim_time.load();
 }
 
 
-bool RadarInterface::dataReady() {
+template <class T>
+bool BasicRadarInterface<T>::dataReady() {
 
-  if (queue_size > 1) 
+  if (queue_size > 0) 
     return true;
 
   queue_size = queue.size();
 
-  return (queue_size > 1);
+  return (queue_size > 0);
 }
 
-PulseData RadarInterface::getData() {
+template <class T>
+BasicPulseData<T> BasicRadarInterface<T>::getData() {
 
-  if (queue_size > 1) {
+  if (queue_size > 0) {
     queue_size--;
     return queue.pop();
   }
@@ -161,7 +244,78 @@ PulseData RadarInterface::getData() {
     throw logic_error(__PRETTY_FUNCTION__ + string(": no data in queue. Check dataReady() first."));
 }
 
-void RadarInterface::stop() {
+template <class T>
+bool BasicRadarInterface<T>::waitData(double timeout)
+//timeout: s
+{
+  if (dataReady())
+    return true;
+
+  queue.wait(timeout);
+  return dataReady();
+}
+
+template <class T>
+BasicPulseData<T> BasicRadarInterface<T>::getDataBlocking() {
+
+  while (!waitData(time_step))
+    if (!on.load() && !dataReady())
+      throw logic_error(__PRETTY_FUNCTION__ + string(": no data in queue, and the simulation is not running."));
+
+  return getData();
+}
+
+template <class T>
+PooledPulseData<T> BasicRadarInterface<T>::getPooledData() {
+  return PooledPulseData<T>(getData(), registry_pool);
+}
+
+template <class T>
+void BasicRadarInterface<T>::recycle(BasicPulseData<T>&& data) {
+  registry_pool->release( move(data.registry) );
+}
+
+template <class T>
+const RegistryPool<T>& BasicRadarInterface<T>::getRegistryPool() const {
+  return *registry_pool;
+}
+
+template <class T>
+size_t BasicRadarInterface<T>::getDataBatch(span<BasicPulseData<T>> batch) {
+  queue_size = 0;
+  return queue.popInto(batch);
+}
+
+template <class T>
+bool BasicRadarInterface<T>::integratedDataReady() {
+
+  if (integrated_queue_size > 0) 
+    return true;
+
+  integrated_queue_size = integrated_queue.size();
+
+  return (integrated_queue_size > 0);
+}
+
+template <class T>
+IntegratedPulseData BasicRadarInterface<T>::getIntegratedData() {
+
+  if (integrated_queue_size > 0) {
+    integrated_queue_size--;
+    return integrated_queue.pop();
+  }
+  else
+    throw logic_error(__PRETTY_FUNCTION__ + string(": no data in queue. Check integratedDataReady() first."));
+}
+
+template <class T>
+void BasicRadarInterface<T>::recycleIntegrated(IntegratedPulseData&& data) {
+  if (integrator)
+    integrator->recycle( move(data) );
+}
+
+template <class T>
+void BasicRadarInterface<T>::stop() {
 
   allow_send_data.store(false);  //this stops data exhange before sim is shut down
   on.store(false);          //shutting down sim
@@ -174,7 +328,8 @@ void RadarInterface::stop() {
   }
 }
 
-void RadarInterface::reset(int t) 
+template <class T>
+void BasicRadarInterface<T>::reset(int t) 
 //t: s
 {
   if (sim_thread)
@@ -182,16 +337,41 @@ void RadarInterface::reset(int t)
 
   queue.empty();
   queue_size = 0;
+  integrated_queue.empty();
+  integrated_queue_size = 0;
+  if (integrator)
+    integrator->reset();
   initiated = false;
   radar.reset(t);
   sim_time.store(t);
   
 }
 
+template <class T>
+size_t BasicRadarInterface<T>::getNumOverruns() const {
+  return queue.getNumOverruns() + integrated_queue.getNumOverruns();
+}
+
 //m
-double RadarInterface::getRange(int bin_index) const {
+template <class T>
+double BasicRadarInterface<T>::getRange(int bin_index) const {
   return min_range + bin_index * range_bin; //m
 }
 
+template <class T>
+int BasicRadarInterface<T>::getNumRangeBins() const {
+  return num_range_bins;
+}
+
+//s
+template <class T>
+double BasicRadarInterface<T>::getPRT() const {
+  return prt; //s
+}
+
+template class BasicRadarInterface<unsigned short>;
+template class BasicRadarInterface<unsigned char>;
+template class BasicRadarInterface<short>;
+
 } //end namespace bkradsim
 
@@ -0,0 +1,195 @@
+#include <math.h>
+
+#include <string>
+#include <complex>
+#include <map>
+#include <mutex>
+
+#include <radsim/mathematics/fourier.hpp>
+
+#include <radsim/radar/bandpass_filter.hpp>
+#include <radsim/radar/radar_model.hpp>
+#include <radsim/radar/radar_model_cache.hpp>
+
+using namespace std;
+
+namespace radsim {
+
+RadarModelKey::RadarModelKey(const RadarConfig& config) :
+  pulse_width( config.getPulseWidth() ),
+  bandwidth( config.getBandWidth() ),
+  horizontal_beam_pattern( config.getHorizontalBeamShape() ),
+  horizontal_beamwidth( config.getHorizontalBeamWidth() ),
+  elevation_beam_pattern( config.getElevationBeamShape() ),
+  elevation_beamwidth( config.getElevationBeamWidth() )
+{
+}
+
+
+RadarModel::RadarModel(const RadarModelKey& key_arg) :
+  key( key_arg ),
+  bandpass_filter( createBandpassFilter(BandpassFilter::Standard, key.bandwidth) ),
+  emitted_pulse( DoubleApproxFunction( {0, key.pulse_width}, (vector<double>){1, 1}, 0, 0) ),
+  filtered_pulse( 0.0 ),
+  horizontal_beam_shape( createBeamPattern(key.horizontal_beam_pattern, key.horizontal_beamwidth) ),
+  elevation_beam_shape( createBeamPattern(key.elevation_beam_pattern, key.elevation_beamwidth) )
+{
+  setFilteredPulse();
+}
+
+
+RadarModel::RadarModel(const RadarModelKey& key_arg, ComplexApproxFunction bandpass_filter_arg, 
+                       DoubleApproxFunction emitted_pulse_arg, DoubleApproxFunction filtered_pulse_arg,
+                       DoubleApproxFunction horizontal_beam_shape_arg, DoubleApproxFunction elevation_beam_shape_arg) :
+  key( key_arg ),
+  bandpass_filter( move(bandpass_filter_arg) ),
+  emitted_pulse( move(emitted_pulse_arg) ),
+  filtered_pulse( move(filtered_pulse_arg) ),
+  horizontal_beam_shape( move(horizontal_beam_shape_arg) ),
+  elevation_beam_shape( move(elevation_beam_shape_arg) )
+{
+}
+
+
+namespace {
+
+  //one per key, so that a model is built once while other keys are looked up or built in parallel
+  struct ModelEntry {
+    mutex build_mutex; //held while loading or building the model of this key
+    weak_ptr<const RadarModel> model; //guarded by models_mutex
+  };
+
+  mutex models_mutex;
+  map<RadarModelKey, shared_ptr<ModelEntry>> live_models; //guarded by models_mutex
+
+  shared_ptr<const RadarModel> findModel(const ModelEntry& entry) {
+    lock_guard<mutex> lock(models_mutex);
+    return entry.model.lock();
+  }
+
+}
+
+
+//models_mutex only guards the map, the cache load and the model build happen under the
+//build_mutex of the key, so only callers asking for the same key wait for them.
+shared_ptr<const RadarModel> RadarModel::get(const RadarModelKey& key_arg) {
+  shared_ptr<ModelEntry> entry;
+  {
+    lock_guard<mutex> lock(models_mutex);
+
+    //dropping expired entries no other caller holds, keeps the map at the number of live models
+    for (auto it = live_models.begin(); it != live_models.end();)
+      if (it->second.use_count() == 1 && it->second->model.expired())
+        it = live_models.erase(it);
+      else
+        it++;
+
+    auto& slot = live_models[key_arg];
+    if (!slot)
+      slot = make_shared<ModelEntry>();
+    entry = slot;
+
+    shared_ptr<const RadarModel> model = entry->model.lock();
+    if (model)
+      return model;
+  }
+
+  lock_guard<mutex> build_lock(entry->build_mutex);
+  shared_ptr<const RadarModel> model = findModel(*entry); //built while waiting
+  if (model)
+    return model;
+
+  model = RadarModelCache::load(key_arg);
+  if (!model) {
+    model = make_shared<const RadarModel>(key_arg);
+    RadarModelCache::store(*model);
+  }
+
+  lock_guard<mutex> lock(models_mutex);
+  entry->model = model;
+  return model;
+}
+
+
+int RadarModel::getNumLiveModels() {
+  lock_guard<mutex> lock(models_mutex);
+
+  int num_live = 0;
+  for (const auto& entry : live_models)
+    if (!entry.second->model.expired())
+      num_live++;
+  return num_live;
+}
+
+
+//Sets the shape of the filtered pulse, s_0, based on the shape of the incoming pulse and the bandpass filter. 
+//See technical document: Signal Reception / BandPass filtering of target signals
+//The transforms are done with FFTs over a window of 16 pulse widths, wide enough for the 
+//filtered pulse to decay before it wraps around. 
+void RadarModel::setFilteredPulse()
+{
+  double pulse_width = key.pulse_width; //s
+  size_t N = 4096;
+  double dt = 16 * pulse_width / N; //s
+  double t_start = 0.5 * (pulse_width + dt - N * dt); //s, pulse centered, sampled mid interval
+
+  //Fourier transforming the incoming pulse s(t)-> S(f)
+  auto S = fastFourierTransform(emitted_pulse, N, dt, t_start); //func(hz) = unit
+  const auto& frequency = S.getEntryVector(); //hz
+  const auto& S_value = S.getValueVector(); //unit
+    
+  //modulating S with the bandpass filter, within |f| < 3 / pulse_width
+  double f_max = 3.0 / pulse_width; //hz
+  vector<complex<double>> HS(N, 0.0); //unit
+  for (size_t k = 0; k < N; k++)
+    if (fabs(frequency[k]) < f_max)
+      HS[k] = S_value[k] * bandpass_filter.output(frequency[k]);
+
+  double df = frequency[1] - frequency[0]; //hz
+  ComplexApproxFunction Modulated(frequency, move(HS)); //func(hz) = unit
+    
+  //Finally, finding the filtered pulse, at times (n - N/2) * dt, kept within [-2, 3] pulse widths:
+  auto filtered_pulse_complex = fastFourierTransform(Modulated, N, df, frequency[0], true); //func(s) = unit
+  const auto& time = filtered_pulse_complex.getEntryVector(); //s
+  const auto& value = filtered_pulse_complex.getValueVector(); //unit
+  vector<double> Time; //s
+  vector<double> amplitude; //unit
+  for (size_t n = 0; n < N; n++)
+    if (time[n] >= -2.0 * pulse_width && time[n] <= 3.0 * pulse_width) {
+      Time.push_back(time[n]); //s
+      amplitude.push_back( abs(value[n]) ); //unit
+    }
+  filtered_pulse = DoubleApproxFunction(move(Time), move(amplitude)); //func(s) = unit
+} 
+
+
+const RadarModelKey& RadarModel::getKey() const {
+  return key;
+}
+
+//func(hz) = unit
+const ComplexApproxFunction& RadarModel::getBandpassFilter() const {
+  return bandpass_filter;
+}
+
+//func(s) = unit
+const DoubleApproxFunction& RadarModel::getEmittedPulse() const {
+  return emitted_pulse;
+}
+
+//func(s) = unit
+const DoubleApproxFunction& RadarModel::getFilteredPulse() const {
+  return filtered_pulse;
+}
+
+//func(rad) = unit, on power level
+const DoubleApproxFunction& RadarModel::getHorizontalBeamShape() const {
+  return horizontal_beam_shape;
+}
+
+//func(rad) = unit, on power level
+const DoubleApproxFunction& RadarModel::getElevationBeamShape() const {
+  return elevation_beam_shape;
+}
+
+}
@@ -0,0 +1,270 @@
+#include <stdlib.h>
+#include <unistd.h>
+
+#include <cstring>
+#include <cstdio>
+#include <complex>
+#include <fstream>
+#include <sstream>
+#include <iomanip>
+#include <mutex>
+#include <filesystem>
+
+#include <radsim/radar/radar_model_cache.hpp>
+
+using namespace std;
+
+namespace radsim {
+
+#ifndef RADSIM_LIBRARY_VERSION
+#define RADSIM_LIBRARY_VERSION "unknown"
+#endif
+
+namespace {
+
+  const char magic[8] = "RSMODEL";
+  const size_t max_version_length = 256;
+
+  mutex directory_mutex;
+  bool   directory_set = false; //guarded by directory_mutex
+  string cache_directory; //guarded by directory_mutex
+
+
+  //FNV-1a
+  void hashBytes(uint64_t& h, const void * data, size_t size) {
+    const unsigned char * bytes = (const unsigned char *) data;
+    for (size_t n = 0; n < size; n++) {
+      h ^= bytes[n];
+      h *= 1099511628211ull;
+    }
+  }
+
+
+  class FileWriter {
+    ofstream ofs;
+
+    public:
+      FileWriter(const string& filename) : ofs(filename, ios::binary) {}
+
+      bool good() const { return ofs.good(); }
+
+      template <class U>
+      void write(U number) {
+        ofs.write((const char *) &number, sizeof number);
+      }
+
+      void writeBytes(const char * bytes, size_t num_bytes) {
+        ofs.write(bytes, num_bytes);
+      }
+
+      template <class T>
+      void writeTable(const ApproxFunction<T>& table) {
+        const auto& value = table.getValueVector();
+        write<int>(value.size());
+        write<T>(table.getInitialValue());
+        write<T>(table.getEndValue());
+        write<double>(table.getFirstEntry());
+        write<double>(table.getLastEntry());
+        write<int>((int) table.getInterpolation());
+        writeBytes((const char *) value.data(), value.size() * sizeof(T));
+      }
+
+      void close() { ofs.close(); }
+  };
+
+
+  //Any failed read, or a read past the end of the file, sets failed.
+  class FileReader {
+    ifstream ifs;
+
+    public:
+      bool failed;
+
+      FileReader(const string& filename) : ifs(filename, ios::binary), failed(!ifs.good()) {}
+
+      bool readBytes(char * bytes, size_t num_bytes) {
+        if (!failed && !ifs.read(bytes, num_bytes))
+          failed = true;
+        return !failed;
+      }
+
+      template <class U>
+      U read() {
+        U number{};
+        readBytes((char *) &number, sizeof number);
+        return number;
+      }
+
+      string readString(size_t max_length) {
+        int length = read<int>();
+        if (failed || length < 0 || size_t(length) > max_length) {
+          failed = true;
+          return "";
+        }
+        string text(length, '\0');
+        readBytes(text.data(), length);
+        return text;
+      }
+
+      //The values are read straight into the table storage.
+      template <class T>
+      ApproxFunction<T> readTable() {
+        int num_entries = read<int>();
+        T initial_value = read<T>();
+        T end_value = read<T>();
+        double first_entry = read<double>();
+        double last_entry = read<double>();
+        int interpolation = read<int>();
+        if (failed || num_entries < 2 || !(last_entry > first_entry) ||
+            (interpolation != (int) Interpolation::Linear && interpolation != (int) Interpolation::Cubic)) {
+          failed = true;
+          return ApproxFunction<T>(T());
+        }
+
+        vector<T> value(num_entries);
+        if (!readBytes((char *) value.data(), num_entries * sizeof(T)))
+          return ApproxFunction<T>(T());
+        return ApproxFunction<T>(first_entry, last_entry, move(value), initial_value, end_value, (Interpolation) interpolation);
+      }
+  };
+
+
+  void writeKey(FileWriter& writer, const RadarModelKey& key) {
+    writer.write<double>(key.pulse_width);
+    writer.write<double>(key.bandwidth);
+    writer.write<int>((int) key.horizontal_beam_pattern);
+    writer.write<double>(key.horizontal_beamwidth);
+    writer.write<int>((int) key.elevation_beam_pattern);
+    writer.write<double>(key.elevation_beamwidth);
+  }
+
+
+  bool readKeyMatches(FileReader& reader, const RadarModelKey& key) {
+    bool match = reader.read<double>() == key.pulse_width;
+    match = (reader.read<double>() == key.bandwidth) && match;
+    match = (reader.read<int>() == (int) key.horizontal_beam_pattern) && match;
+    match = (reader.read<double>() == key.horizontal_beamwidth) && match;
+    match = (reader.read<int>() == (int) key.elevation_beam_pattern) && match;
+    match = (reader.read<double>() == key.elevation_beamwidth) && match;
+    return match && !reader.failed;
+  }
+
+} //end empty namespace
+
+
+void RadarModelCache::setDirectory(const string& directory) {
+  lock_guard<mutex> lock(directory_mutex);
+  cache_directory = directory;
+  directory_set = true;
+}
+
+
+string RadarModelCache::getDirectory() {
+  lock_guard<mutex> lock(directory_mutex);
+  if (!directory_set) {
+    const char * env_directory = getenv("RADSIM_CACHE_DIR");
+    if (env_directory)
+      cache_directory = env_directory;
+    directory_set = true;
+  }
+  return cache_directory;
+}
+
+
+string RadarModelCache::getLibraryVersion() {
+  return RADSIM_LIBRARY_VERSION;
+}
+
+
+uint64_t RadarModelCache::hash(const RadarModelKey& key) {
+  uint64_t h = 14695981039346656037ull;
+  int version = format_version;
+  string library_version = getLibraryVersion();
+  int horizontal_pattern = (int) key.horizontal_beam_pattern;
+  int elevation_pattern = (int) key.elevation_beam_pattern;
+  hashBytes(h, &version, sizeof version);
+  hashBytes(h, library_version.data(), library_version.size());
+  hashBytes(h, &key.pulse_width, sizeof key.pulse_width);
+  hashBytes(h, &key.bandwidth, sizeof key.bandwidth);
+  hashBytes(h, &horizontal_pattern, sizeof horizontal_pattern);
+  hashBytes(h, &key.horizontal_beamwidth, sizeof key.horizontal_beamwidth);
+  hashBytes(h, &elevation_pattern, sizeof elevation_pattern);
+  hashBytes(h, &key.elevation_beamwidth, sizeof key.elevation_beamwidth);
+  return h;
+}
+
+
+string RadarModelCache::getFilename(const RadarModelKey& key) {
+  string directory = getDirectory();
+  if (directory.empty())
+    return "";
+
+  ostringstream filename;
+  filename << directory << "/radar_model_" << hex << setw(16) << setfill('0') << hash(key) << ".bin";
+  return filename.str();
+}
+
+
+shared_ptr<const RadarModel> RadarModelCache::load(const RadarModelKey& key) {
+  string filename = getFilename(key);
+  if (filename.empty())
+    return nullptr;
+
+  FileReader reader(filename);
+  if (reader.failed)
+    return nullptr;
+
+  char file_magic[sizeof magic];
+  reader.readBytes(file_magic, sizeof magic);
+  if (reader.failed || memcmp(file_magic, magic, sizeof magic) != 0 || reader.read<int>() != format_version ||
+      reader.readString(max_version_length) != getLibraryVersion() || !readKeyMatches(reader, key))
+    return nullptr;
+
+  auto bandpass_filter = reader.readTable<complex<double>>();
+  auto emitted_pulse = reader.readTable<double>();
+  auto filtered_pulse = reader.readTable<double>();
+  auto horizontal_beam_shape = reader.readTable<double>();
+  auto elevation_beam_shape = reader.readTable<double>();
+  if (reader.failed)
+    return nullptr;
+
+  return make_shared<const RadarModel>(key, move(bandpass_filter), move(emitted_pulse), move(filtered_pulse),
+                                       move(horizontal_beam_shape), move(elevation_beam_shape));
+}
+
+
+bool RadarModelCache::store(const RadarModel& model) {
+  string filename = getFilename(model.getKey());
+  if (filename.empty())
+    return false;
+
+  error_code error;
+  filesystem::create_directories(filesystem::path(filename).parent_path(), error);
+
+  string temp_filename = filename + ".tmp" + std::to_string(getpid());
+  FileWriter writer(temp_filename);
+  if (!writer.good())
+    return false;
+
+  writer.writeBytes(magic, sizeof magic);
+  writer.write<int>(format_version);
+  string library_version = getLibraryVersion();
+  writer.write<int>(library_version.size());
+  writer.writeBytes(library_version.data(), library_version.size());
+  writeKey(writer, model.getKey());
+  writer.writeTable(model.getBandpassFilter());
+  writer.writeTable(model.getEmittedPulse());
+  writer.writeTable(model.getFilteredPulse());
+  writer.writeTable(model.getHorizontalBeamShape());
+  writer.writeTable(model.getElevationBeamShape());
+  writer.close();
+  bool written = writer.good();
+
+  if (!written || rename(temp_filename.c_str(), filename.c_str()) != 0) {
+    remove(temp_filename.c_str());
+    return false;
+  }
+  return true;
+}
+
+}
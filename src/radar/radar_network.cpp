@@ -0,0 +1,244 @@
+#include <chrono>
+
+#include <radsim/utils/timer.hpp>
+
+#include <radsim/radar/radar_network.hpp>
+
+using namespace std;
+using namespace radsim;
+
+
+namespace radsim {
+
+template <class T>
+BasicRadarNetwork<T>::RadarNode::RadarNode(const RadarConfig& config) :
+  radar( config ),
+  queue_size( 0 )
+{
+  radar.checkSampleType<T>();
+}
+
+
+template <class T>
+BasicRadarNetwork<T>::BasicRadarNetwork(shared_ptr<const TargetCollection> targets_arg, int num_threads, double dt) :
+  targets( move(targets_arg) ),
+  pool( num_threads ),
+  sim_thread( NULL ),
+  sim_time( 0 ),
+  on( false ),
+  initiated( false ),
+  time_step( dt )
+{
+  if (!targets)
+    throw invalid_argument(__PRETTY_FUNCTION__ + string(": the target snapshot cannot be null."));
+  if (time_step <= 0)
+    throw invalid_argument(__PRETTY_FUNCTION__ + string(": time step must be positive."));
+}
+
+
+template <class T>
+BasicRadarNetwork<T>::~BasicRadarNetwork() {
+  stop();
+}
+
+
+template <class T>
+int BasicRadarNetwork<T>::addRadar(const RadarConfig& config) {
+  if (initiated)
+    throw logic_error(__PRETTY_FUNCTION__ + string(": cannot add radars after simulation start without reset."));
+
+  nodes.emplace_back( new RadarNode(config) );
+  nodes.back()->radar.reset( sim_time.load() );
+  return nodes.size() - 1;
+}
+
+
+template <class T>
+void BasicRadarNetwork<T>::setTargets(shared_ptr<const TargetCollection> targets_arg) {
+  if (sim_thread)
+    throw logic_error(__PRETTY_FUNCTION__ + string(": cannot set targets when simulation thread is running."));
+  if (!targets_arg)
+    throw invalid_argument(__PRETTY_FUNCTION__ + string(": the target snapshot cannot be null."));
+
+  targets = move(targets_arg);
+}
+
+
+template <class T>
+void BasicRadarNetwork<T>::setAddNoise(bool set) {
+  if (sim_thread)
+    throw logic_error(__PRETTY_FUNCTION__ + string(": cannot set radar parameters when simulation thread is running."));
+
+  for (auto& node : nodes)
+    node->radar.setToAddNoise(set);
+}
+
+
+//The first pulse of every radar, at time 0, is queued in parallel.
+template <class T>
+void BasicRadarNetwork<T>::initiate() {
+  if (initiated)
+    return;
+
+  const TargetCollection& target_collection = *targets;
+  pool.parallelFor(0, nodes.size(), [&](size_t n) {
+    RadarNode& node = *nodes[n];
+    node.queue.push( node.radar.template generate<T>(target_collection) );
+  });
+  initiated = true;
+}
+
+
+//Only the radars with pulses due before t_end are handed to the pool. 
+template <class T>
+void BasicRadarNetwork<T>::runPulses(double t_end)
+//t_end: s
+{
+  vector<size_t> due;
+  for (size_t n = 0; n < nodes.size(); n++)
+    if (nodes[n]->radar.getCurrentTime() < t_end)
+      due.push_back(n);
+
+  const TargetCollection& target_collection = *targets;
+  pool.parallelFor(0, due.size(), [&](size_t k) {
+    RadarNode& node = *nodes[ due[k] ];
+    while (node.radar.getCurrentTime() < t_end)
+      node.queue.push( node.radar.template generate<T>(target_collection) );
+  });
+  sim_time.store(t_end); //s
+}
+
+
+//Runs the radars one time step ahead, then sleeps until the wall clock has caught up. 
+template <class T>
+void BasicRadarNetwork<T>::schedulerLoop() {
+  initiate();
+
+  Timer timer;
+  double start_time = sim_time.load(); //s
+  double sim_check = start_time + time_step; //s
+
+  while (on.load()) {
+    runPulses(sim_check);
+
+    timer.sleepUntil(sim_check - start_time);
+
+    sim_check += time_step; //s
+  }
+}
+
+
+template <class T>
+void BasicRadarNetwork<T>::start() {
+  if (sim_thread)
+    throw logic_error(__PRETTY_FUNCTION__ + string(": cannot restart simulator without stopping first."));
+
+  on.store(true);
+  sim_thread = new thread(&BasicRadarNetwork<T>::schedulerLoop, this);
+}
+
+
+template <class T>
+void BasicRadarNetwork<T>::stop() {
+  on.store(false);
+  if (sim_thread) {
+    sim_thread->join();
+    delete sim_thread;
+    sim_thread = NULL;
+  }
+}
+
+
+template <class T>
+void BasicRadarNetwork<T>::reset(double t)
+//t: s
+{
+  if (sim_thread)
+    throw logic_error(__PRETTY_FUNCTION__ + string(": cannot reset simulator without stopping first."));
+
+  for (auto& node : nodes) {
+    node->queue.empty();
+    node->queue_size = 0;
+    node->radar.reset(t);
+  }
+  initiated = false;
+  sim_time.store(t); //s
+}
+
+
+template <class T>
+void BasicRadarNetwork<T>::advance(double t)
+//t: s
+{
+  if (sim_thread)
+    throw logic_error(__PRETTY_FUNCTION__ + string(": cannot advance simulator when simulation thread is running."));
+
+  initiate();
+  if (t > sim_time.load())
+    runPulses(t);
+}
+
+
+//s
+template <class T>
+double BasicRadarNetwork<T>::getSimTime() const {
+  return sim_time.load(); //s
+}
+
+
+template <class T>
+int BasicRadarNetwork<T>::getNumRadars() const {
+  return nodes.size();
+}
+
+
+template <class T>
+int BasicRadarNetwork<T>::getNumThreads() const {
+  return pool.getNumThreads();
+}
+
+
+template <class T>
+const Radar& BasicRadarNetwork<T>::getRadar(int index) const {
+  if (index < 0 || index >= (int) nodes.size())
+    throw invalid_argument(__PRETTY_FUNCTION__ + string(": invalid radar index."));
+  return nodes[index]->radar;
+}
+
+
+template <class T>
+bool BasicRadarNetwork<T>::dataReady(int index) {
+  if (index < 0 || index >= (int) nodes.size())
+    throw invalid_argument(__PRETTY_FUNCTION__ + string(": invalid radar index."));
+
+  RadarNode& node = *nodes[index];
+  if (node.queue_size > 0)
+    return true;
+
+  node.queue_size = node.queue.size();
+  return (node.queue_size > 0);
+}
+
+
+template <class T>
+BasicPulseData<T> BasicRadarNetwork<T>::getData(int index) {
+  if (!dataReady(index))
+    throw logic_error(__PRETTY_FUNCTION__ + string(": no data in queue. Check dataReady() first."));
+
+  RadarNode& node = *nodes[index];
+  node.queue_size--;
+  return node.queue.pop();
+}
+
+template <class T>
+size_t BasicRadarNetwork<T>::getNumOverruns(int index) const {
+  if (index < 0 || index >= (int) nodes.size())
+    throw invalid_argument(__PRETTY_FUNCTION__ + string(": invalid radar index."));
+  return nodes[index]->queue.getNumOverruns();
+}
+
+template class BasicRadarNetwork<unsigned short>;
+template class BasicRadarNetwork<unsigned char>;
+template class BasicRadarNetwork<short>;
+
+} //end namespace radsim
@@ -8,10 +8,11 @@ using namespace std;
 
 namespace radsim {
 
-PulseCarry::PulseCarry(double time_arg, double power_arg, const math_vector& pos_arg) :
+PulseCarry::PulseCarry(double time_arg, double power_arg, const math_vector& pos_arg, double phase_arg) :
   time(time_arg),
   power(power_arg),
-  pos(pos_arg)
+  pos(pos_arg),
+  phase(phase_arg)
 {}
 
 
@@ -0,0 +1,138 @@
+#include <stdexcept>
+#include <string>
+
+#include <radsim/radar/registry_pool.hpp>
+
+using namespace std;
+
+namespace radsim {
+
+namespace {
+
+  uint64_t packHead(uint64_t counter, uint32_t index) {
+    return (counter << 32) | index;
+  }
+
+  uint32_t headIndex(uint64_t head) {
+    return uint32_t(head);
+  }
+
+  uint64_t headCounter(uint64_t head) {
+    return head >> 32;
+  }
+
+} //end empty namespace
+
+
+template <class T>
+RegistryPool<T>::RegistryPool(size_t capacity) :
+  buffers( capacity ),
+  next( capacity ),
+  held_head( packHead(0, null_index) ),
+  free_head( packHead(0, null_index) ),
+  num_misses( 0 )
+{
+  if (capacity == 0 || capacity >= null_index)
+    throw invalid_argument(__PRETTY_FUNCTION__ + string(": capacity must be positive and below 2^32 - 1."));
+
+  for (uint32_t n = 0; n < capacity; n++)
+    push(free_head, n);
+}
+
+
+//null_index if the stack is empty
+template <class T>
+uint32_t RegistryPool<T>::pop(atomic<uint64_t>& stack_head) {
+  uint64_t head = stack_head.load(memory_order_acquire);
+  while (headIndex(head) != null_index) {
+    uint32_t below = next[headIndex(head)].load(memory_order_relaxed);
+    if (stack_head.compare_exchange_weak(head, packHead(headCounter(head) + 1, below),
+                                         memory_order_acquire, memory_order_acquire))
+      return headIndex(head);
+  }
+  return null_index;
+}
+
+
+template <class T>
+void RegistryPool<T>::push(atomic<uint64_t>& stack_head, uint32_t index) {
+  uint64_t head = stack_head.load(memory_order_relaxed);
+  do {
+    next[index].store(headIndex(head), memory_order_relaxed);
+  } while (!stack_head.compare_exchange_weak(head, packHead(headCounter(head) + 1, index),
+                                             memory_order_release, memory_order_relaxed));
+}
+
+
+template <class T>
+vector<T> RegistryPool<T>::acquire() {
+  uint32_t index = pop(held_head);
+  if (index == null_index) {
+    num_misses.fetch_add(1, memory_order_relaxed);
+    return vector<T>();
+  }
+
+  vector<T> buffer = move(buffers[index]);
+  push(free_head, index);
+  return buffer;
+}
+
+
+template <class T>
+void RegistryPool<T>::release(vector<T>&& buffer) {
+  if (buffer.capacity() == 0)
+    return;
+
+  uint32_t index = pop(free_head);
+  if (index == null_index)
+    return; //full, buffer is freed by the caller
+
+  buffers[index] = move(buffer);
+  push(held_head, index);
+}
+
+
+template <class T>
+size_t RegistryPool<T>::getCapacity() const {
+  return buffers.size();
+}
+
+template <class T>
+size_t RegistryPool<T>::getNumMisses() const {
+  return num_misses.load(memory_order_relaxed);
+}
+
+
+template <class T>
+PooledPulseData<T>::PooledPulseData(BasicPulseData<T>&& data_arg, shared_ptr<RegistryPool<T>> pool_arg) :
+  data( move(data_arg) ),
+  pool( move(pool_arg) )
+{
+}
+
+template <class T>
+PooledPulseData<T>& PooledPulseData<T>::operator=(PooledPulseData&& other) {
+  if (pool)
+    pool->release( move(data.registry) );
+  data = move(other.data);
+  pool = move(other.pool);
+  return *this;
+}
+
+template <class T>
+PooledPulseData<T>::~PooledPulseData() {
+  if (pool)
+    pool->release( move(data.registry) );
+}
+
+
+template class RegistryPool<unsigned short>;
+template class RegistryPool<unsigned char>;
+template class RegistryPool<short>;
+template class RegistryPool<unsigned int>; //PulseIntegrator accumulators
+
+template class PooledPulseData<unsigned short>;
+template class PooledPulseData<unsigned char>;
+template class PooledPulseData<short>;
+
+}
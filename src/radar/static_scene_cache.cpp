@@ -0,0 +1,87 @@
+#include <math.h>
+
+#include <stdexcept>
+#include <string>
+
+#include <radsim/mathematics/constants.hpp>
+
+#include <radsim/radar/static_scene_cache.hpp>
+
+using namespace std;
+
+namespace radsim {
+
+StaticEcho::StaticEcho(int bin_arg, double amplitude_arg, complex<double> phasor_arg) :
+  bin( bin_arg ),
+  amplitude( amplitude_arg ),
+  phasor( phasor_arg )
+{
+}
+
+
+StaticSceneCache::StaticSceneCache(double step_arg, double init_theta_arg) :
+  step( fabs(step_arg) ),
+  init_theta( init_theta_arg )
+{
+  num_slots = 1;
+  if (step > 0 && step < pi)
+    num_slots = ceil(2 * pi / step - 1e-9); //the last slot is less than a step from the first
+  echoes.resize(num_slots);
+  cached.assign(num_slots, false);
+}
+
+
+int StaticSceneCache::findSlot(double theta) const
+//theta: rad
+{
+  if (num_slots == 1)
+    return 0;
+
+  double offset = fmod(theta - init_theta, 2 * pi); //rad
+  if (offset < 0)
+    offset += 2 * pi; //[0, 2 pi>
+  return lround(offset / step) % num_slots;
+}
+
+
+bool StaticSceneCache::isCached(int slot) const {
+  return cached[slot];
+}
+
+
+const vector<StaticEcho>& StaticSceneCache::getEchoes(int slot) const {
+  if (!cached[slot])
+    throw logic_error(__PRETTY_FUNCTION__ + string(": slot is not cached. Check isCached() first."));
+  return echoes[slot];
+}
+
+
+void StaticSceneCache::setEchoes(int slot, vector<StaticEcho> slot_echoes) {
+  if (slot < 0 || slot >= num_slots)
+    throw invalid_argument(__PRETTY_FUNCTION__ + string(": slot out of range."));
+  echoes[slot] = move(slot_echoes);
+  cached[slot] = true;
+}
+
+
+int StaticSceneCache::getNumSlots() const {
+  return num_slots;
+}
+
+
+int StaticSceneCache::getNumCachedSlots() const {
+  int num_cached = 0;
+  for (bool is_cached : cached)
+    if (is_cached)
+      num_cached++;
+  return num_cached;
+}
+
+
+void StaticSceneCache::clear() {
+  for (auto& slot_echoes : echoes)
+    slot_echoes = vector<StaticEcho>();
+  cached.assign(num_slots, false);
+}
+
+}
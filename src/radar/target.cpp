@@ -1,6 +1,8 @@
 #include <iostream>
 #include <memory>
 #include <vector>
+#include <stdexcept>
+#include <string>
 
 #include <radsim/radar/target.hpp>
 
@@ -10,22 +12,49 @@ namespace radsim {
 
 Target::Target(const math_vector& pos, double rcs) :
   path( VectorApproxFunction(pos) ),
+  trajectory_cursor( 0 ),
   RCS( rcs )
 {
 }
 
 Target::Target(VectorApproxFunction path_, double rcs) :
   path( move(path_) ),
+  trajectory_cursor( 0 ),
+  RCS( rcs )
+{
+}
+
+Target::Target(Trajectory trajectory_, double rcs) :
+  trajectory( make_shared<const Trajectory>(move(trajectory_)) ),
+  trajectory_cursor( 0 ),
   RCS( rcs )
 {
 }
 
 Target::Target(Target&& other) :
   path( move(other.path) ),
+  trajectory( move(other.trajectory) ),
+  trajectory_cursor( other.trajectory_cursor.load(memory_order_relaxed) ),
+  RCS( other.RCS )
+{
+}
+
+Target::Target(const Target& other) :
+  path( other.path ),
+  trajectory( other.trajectory ),
+  trajectory_cursor( other.trajectory_cursor.load(memory_order_relaxed) ),
   RCS( other.RCS )
 {
 }
 
+Target& Target::operator=(const Target& other) {
+  path = other.path;
+  trajectory = other.trajectory;
+  trajectory_cursor.store( other.trajectory_cursor.load(memory_order_relaxed), memory_order_relaxed );
+  RCS = other.RCS;
+  return *this;
+}
+
 Target::~Target()
 {
 }
@@ -34,17 +63,38 @@ Target::~Target()
 math_vector Target::getPosition(double t) const
 //t: s, time position along path curve
 {
-  return path.output(t);
+  if (trajectory) {
+    //relaxed, the cursor is only a hint, and any value gives the right position
+    size_t cursor = trajectory_cursor.load(memory_order_relaxed);
+    math_vector pos = trajectory->output(t, cursor);
+    trajectory_cursor.store(cursor, memory_order_relaxed);
+    return pos;
+  }
+  return path->output(t);
 }
 
 const VectorApproxFunction& Target::getPath() const {
-  return path;
+  if (!path)
+    throw logic_error(__PRETTY_FUNCTION__ + string(": the target follows a Trajectory."));
+  return *path;
+}
+
+bool Target::hasTrajectory() const {
+  return bool(trajectory);
+}
+
+const Trajectory& Target::getTrajectory() const {
+  if (!trajectory)
+    throw logic_error(__PRETTY_FUNCTION__ + string(": the target has no Trajectory."));
+  return *trajectory;
 }
 
 void Target::setPosition(const math_vector& pos)
 //pos: m
 {
   path = VectorApproxFunction(pos);
+  trajectory.reset();
+  trajectory_cursor.store(0, memory_order_relaxed);
 }
 
 //m2
@@ -0,0 +1,165 @@
+#include <stdexcept>
+#include <string>
+#include <utility>
+
+#include <radsim/radar/trajectory.hpp>
+
+using namespace std;
+
+namespace radsim {
+
+namespace {
+
+  //m, the position on the line from a at time t_a to b at time t_b, at time t
+  math_vector interpolate(const math_vector& a, double t_a, const math_vector& b, double t_b, double t) {
+    double w = (t - t_a) / (t_b - t_a);
+    return (1 - w) * a + w * b;
+  }
+
+} //end empty namespace
+
+
+Trajectory::Trajectory(vector<double> time_arg, vector<math_vector> position_arg, double tolerance) :
+  time( move(time_arg) ),
+  position( move(position_arg) )
+{
+  if (time.empty())
+    throw invalid_argument(__PRETTY_FUNCTION__ + string(": must have at least one point."));
+  if (time.size() != position.size())
+    throw invalid_argument(__PRETTY_FUNCTION__ + string(": vectors time and position must be of equal size."));
+  for (size_t n = 1; n < time.size(); n++)
+    if (!(time[n] > time[n-1]))
+      throw invalid_argument(__PRETTY_FUNCTION__ + string(": times must be strictly increasing."));
+  if (tolerance < 0)
+    throw invalid_argument(__PRETTY_FUNCTION__ + string(": tolerance must be non-negative."));
+
+  if (tolerance > 0)
+    simplify(tolerance);
+}
+
+
+//Douglas-Peucker with the distance between each point and the path position at the same time.
+//The segments still to be checked are kept on a stack rather than recursing, since long tracks
+//can split deeply.
+void Trajectory::simplify(double tolerance)
+//tolerance: m
+{
+  size_t size = time.size();
+  if (size < 3)
+    return;
+
+  vector<bool> keep(size, false);
+  keep.front() = true;
+  keep.back() = true;
+  vector<pair<size_t, size_t>> segments = { {0, size - 1} };
+  while (!segments.empty()) {
+    auto [first, last] = segments.back();
+    segments.pop_back();
+
+    double max_distance = 0; //m
+    size_t farthest = first;
+    for (size_t n = first + 1; n < last; n++) {
+      math_vector path = interpolate(position[first], time[first], position[last], time[last], time[n]);
+      double distance = math_vector_length(position[n] - path); //m
+      if (distance > max_distance) {
+        max_distance = distance;
+        farthest = n;
+      }
+    }
+
+    if (max_distance > tolerance) {
+      keep[farthest] = true;
+      segments.push_back( {first, farthest} );
+      segments.push_back( {farthest, last} );
+    }
+  }
+
+  size_t num_kept = 0;
+  for (size_t n = 0; n < size; n++)
+    if (keep[n]) {
+      time[num_kept] = time[n];
+      position[num_kept] = position[n];
+      num_kept++;
+    }
+  time.resize(num_kept);
+  position.resize(num_kept);
+  time.shrink_to_fit();
+  position.shrink_to_fit();
+}
+
+
+//The segment n with time[n] <= t < time[n + 1], for time.front() <= t < time.back().
+//Searches forward from the hint in steps 1, 2, 4, ..., then bisects the last step.
+//Earlier times are bisected from the start.
+size_t Trajectory::findSegment(double t, size_t hint) const {
+  size_t last = time.size() - 1;
+  size_t low = hint;
+  if (low >= last)
+    low = 0;
+
+  size_t high; //time[high] > t
+  if (time[low] > t) {
+    high = low;
+    low = 0;
+  }
+  else {
+    size_t step = 1;
+    high = low + 1;
+    while (time[high] <= t) {
+      low = high;
+      high = min(low + step, last);
+      step *= 2;
+    }
+  }
+
+  while (high - low > 1) {
+    size_t middle = low + (high - low) / 2;
+    if (time[middle] <= t)
+      low = middle;
+    else
+      high = middle;
+  }
+
+  return low;
+}
+
+
+//m
+math_vector Trajectory::output(double t) const
+//t: s
+{
+  size_t cursor = 0;
+  return output(t, cursor);
+}
+
+
+//m
+math_vector Trajectory::output(double t, size_t& cursor) const
+//t: s
+{
+  if (t <= time.front())
+    return position.front();
+  if (t >= time.back())
+    return position.back();
+
+  size_t n = findSegment(t, cursor);
+  cursor = n;
+  return interpolate(position[n], time[n], position[n+1], time[n+1], t);
+}
+
+
+size_t Trajectory::getNumPoints() const {
+  return time.size();
+}
+
+//s
+const vector<double>& Trajectory::getTimeVector() const {
+  return time;
+}
+
+//m
+const vector<math_vector>& Trajectory::getPositionVector() const {
+  return position;
+}
+
+}
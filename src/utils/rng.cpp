@@ -3,6 +3,8 @@
 #include <time.h>
 
 #include <exception>
+#include <stdexcept>
+#include <string>
 #include <iostream>
 
 #include <radsim/utils/rng.hpp>
@@ -33,7 +35,10 @@ void RNG::set_default_Q() {
   Q = &Q_default;
 }
 
-RNG::RNG(bool custom, int seed_value, double (*Q_custom)(unsigned int *)) {
+RNG::RNG(bool custom, int seed_value, double (*Q_custom)(unsigned int *)) :
+  wide_seed( 0 ),
+  Q_wide( NULL )
+{
 
   if (custom)
     seed = seed_value;
@@ -47,12 +52,46 @@ RNG::RNG(bool custom, int seed_value, double (*Q_custom)(unsigned int *)) {
 }
 
 
+RNG::RNG(uint64_t seed_value, double (*Q_wide_custom)(uint64_t *)) :
+  seed( 0 ),
+  Q( &Q_default ),
+  wide_seed( seed_value ),
+  Q_wide( Q_wide_custom )
+{
+  if (Q_wide == NULL)
+    throw invalid_argument(__PRETTY_FUNCTION__ + string(": randomizing function must be set."));
+}
+
+
+void RNG::setSeed(uint64_t seed_value) {
+  if (Q_wide)
+    wide_seed = seed_value;
+  else
+    seed = (unsigned int) (seed_value ^ (seed_value >> 32));
+}
+
+
 double RNG::output() {
+  if (Q_wide)
+    return Q_wide(&wide_seed);
   return Q(&seed);
 }
 
 unsigned int RNG::getSeed() {
+  if (Q_wide)
+    return (unsigned int) (wide_seed ^ (wide_seed >> 32));
   return seed;
 }
 
+
+//Steele, Lea and Flood, Fast splittable pseudorandom number generators, 2014.
+//The state steps by splitmix64_increment, the output is a mix of the state, 53 bits kept. 
+double RNG::splitmix64(uint64_t * seed) {
+  uint64_t z = (*seed += splitmix64_increment);
+  z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ULL;
+  z = (z ^ (z >> 27)) * 0x94d049bb133111ebULL;
+  z ^= z >> 31;
+  return (z >> 11) * 0x1.0p-53;
+}
+
 }
@@ -0,0 +1,119 @@
+#include <stdexcept>
+#include <string>
+
+#include <radsim/utils/thread_pool.hpp>
+
+using namespace std;
+
+namespace radsim {
+
+ThreadPool::ThreadPool(int num_threads) :
+  job(NULL),
+  job_end(0),
+  chunk(1),
+  generation(0),
+  num_busy(0),
+  stopping(false),
+  next_index(0)
+{
+  if (num_threads < 0) {
+    num_threads = (int) thread::hardware_concurrency() - 1;
+    if (num_threads < 0)
+      num_threads = 0;
+  }
+
+  for (int n = 0; n < num_threads; n++)
+    workers.emplace_back(&ThreadPool::workerLoop, this);
+}
+
+
+ThreadPool::~ThreadPool() {
+  {
+    lock_guard<mutex> lock(mtx);
+    stopping = true;
+  }
+  cv_start.notify_all();
+  for (auto& worker : workers)
+    worker.join();
+}
+
+
+int ThreadPool::getNumThreads() const {
+  return workers.size() + 1;
+}
+
+
+void ThreadPool::runChunks(const function<void(size_t)>& func, size_t end, size_t chunk_size) {
+  while (true) {
+    size_t first = next_index.fetch_add(chunk_size);
+    if (first >= end)
+      break;
+    size_t last = min(first + chunk_size, end);
+    for (size_t n = first; n < last; n++)
+      func(n);
+  }
+}
+
+
+void ThreadPool::workerLoop() {
+  unsigned long seen_generation = 0;
+  while (true) {
+    const function<void(size_t)> * func;
+    size_t end, chunk_size;
+    {
+      unique_lock<mutex> lock(mtx);
+      cv_start.wait(lock, [&] { return stopping || generation != seen_generation; });
+      if (stopping)
+        return;
+      seen_generation = generation;
+      func = job;
+      end = job_end;
+      chunk_size = chunk;
+    }
+
+    runChunks(*func, end, chunk_size);
+
+    {
+      lock_guard<mutex> lock(mtx);
+      num_busy--;
+    }
+    cv_done.notify_one();
+  }
+}
+
+
+void ThreadPool::parallelFor(size_t begin, size_t end, const function<void(size_t)>& func, size_t chunk_size) {
+  if (begin >= end)
+    return;
+
+  if (workers.empty()) {
+    for (size_t n = begin; n < end; n++)
+      func(n);
+    return;
+  }
+
+  if (chunk_size == 0) {
+    size_t num_chunks = 4 * getNumThreads(); //a few chunks per thread for load balance
+    chunk_size = (end - begin + num_chunks - 1) / num_chunks;
+  }
+  {
+    lock_guard<mutex> lock(mtx);
+    if (job)
+      throw logic_error(__PRETTY_FUNCTION__ + string(": parallelFor cannot be nested or called concurrently."));
+    job = &func;
+    job_end = end;
+    chunk = chunk_size;
+    next_index.store(begin);
+    num_busy = workers.size();
+    generation++;
+  }
+  cv_start.notify_all();
+
+  runChunks(func, end, chunk_size);
+
+  unique_lock<mutex> lock(mtx);
+  cv_done.wait(lock, [&] { return num_busy == 0; });
+  job = NULL;
+}
+
+}
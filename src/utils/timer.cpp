@@ -1,5 +1,6 @@
 #include <chrono>
 #include <ctime>
+#include <cerrno>
 
 #include <radsim/utils/timer.hpp>
 
@@ -9,15 +10,38 @@ using namespace std::chrono;
 namespace radsim {
 
 Timer::Timer() :
-  t_start( high_resolution_clock::now() )
+  t_start( steady_clock::now() )
 {
 }
 
 //s
 double Timer::elapsed() {
-  high_resolution_clock::time_point t_now = high_resolution_clock::now();
+  steady_clock::time_point t_now = steady_clock::now();
   duration<double> time_span = duration_cast<duration<double>>(t_now - t_start);
   return time_span.count();
 }
 
+
+//The sleep is to an absolute time on the monotonic clock, which the steady_clock reads, so an
+//early wake-up or a signal does not shift the deadline.
+void Timer::sleepUntil(double t, double slack)
+//t: s
+//slack: s
+{
+  steady_clock::time_point deadline = t_start + duration_cast<steady_clock::duration>(duration<double>(t));
+  steady_clock::time_point wake = deadline - duration_cast<steady_clock::duration>(duration<double>(slack));
+
+  if (steady_clock::now() < wake) {
+    nanoseconds since_epoch = duration_cast<nanoseconds>(wake.time_since_epoch());
+    timespec request;
+    request.tv_sec = since_epoch.count() / 1000000000;
+    request.tv_nsec = since_epoch.count() % 1000000000;
+    while (clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &request, NULL) == EINTR)
+      ;
+  }
+
+  while (steady_clock::now() < deadline) {
+  } //busy-wait
+}
+
 }
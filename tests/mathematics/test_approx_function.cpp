@@ -1,11 +1,14 @@
 #include <iostream>
 #include <complex>
+#include <cmath>
 #include <vector>
 
 #include <radsim/utils/assert.hpp>
 
 #include <radsim/mathematics/math_vector.hpp>
 #include <radsim/mathematics/approx_function.hpp>
+#include <radsim/mathematics/static_approx_function.hpp>
+#include <radsim/mathematics/mathutils.hpp>
 
 using namespace std;
 using namespace std::complex_literals;
@@ -18,7 +21,6 @@ void test_simple() {
   std::vector<double> entry_copy = entry;
   std::vector<double> value_copy = value;
 
-  double * entry_ptr = entry.data();
   double * value_ptr = value.data();
 
   ApproxFunction<double> func( move(entry), move(value) );
@@ -28,14 +30,13 @@ void test_simple() {
   assertDoubleEqual( func.output(-0.5), 2.0, 1e-4 );
   assertDoubleEqual( func.output(8.0), 4.0, 1e-4 );
 
-  assertTrue( entry_ptr == func.getEntryVector().data() );
+  assertTrue( entry_copy == func.getEntryVector() );
   assertTrue( value_ptr == func.getValueVector().data() );
 
   ApproxFunction<double> copy = func;
   assertTrue( entry_copy == copy.getEntryVector() );
   assertTrue( value_copy == copy.getValueVector() );
 
-  assertTrue( entry_ptr == func.getEntryVector().data() );
   assertTrue( value_ptr == func.getValueVector().data() ); 
 
   vector<double> input = {-0.5, 8.0};
@@ -66,15 +67,12 @@ void test_move() {
 
   std::vector<double> entry = {0.0, 1.0};
   std::vector<double> value = {2.0, 4.0};
-  double * entry_ptr = entry.data();
   double * value_ptr = value.data();
 
   ApproxFunction<double> func( move(entry), move(value) );
-  assertTrue( entry_ptr == func.getEntryVector().data() );
   assertTrue( value_ptr == func.getValueVector().data() );
 
   ApproxFunction<double> copy = move(func);
-  assertTrue( entry_ptr == copy.getEntryVector().data() );
   assertTrue( value_ptr == copy.getValueVector().data() );
 
   assertDoubleEqual( copy.output(-1), 2.0, 1e-3 );
@@ -89,10 +87,9 @@ void use_elsewhere(const ApproxFunction<double>& func) {
 }
 
 
-ApproxFunction<double> function(double ** entry_ptr, double ** value_ptr) {
+ApproxFunction<double> function(double ** value_ptr) {
   std::vector<double> entry = {0.0, 1.0};
   std::vector<double> value = {2.0, 4.0};
-  *entry_ptr = entry.data();
   *value_ptr = value.data();
   
   ApproxFunction<double> func( move(entry), move(value) );
@@ -102,10 +99,8 @@ ApproxFunction<double> function(double ** entry_ptr, double ** value_ptr) {
 
 
 void test_return() {
-  double * entry_ptr;
   double * value_ptr;
-  ApproxFunction<double> func = function(&entry_ptr, &value_ptr);
-  assertTrue( func.getEntryVector().data() == entry_ptr );
+  ApproxFunction<double> func = function(&value_ptr);
   assertTrue( func.getValueVector().data() == value_ptr );
 }
 
@@ -116,7 +111,7 @@ void test_complex() {
                                                3.0+(3.0i)};
   ApproxFunction<complex<double>> func(entry, value);
   assertComplexEqual( func.output(1.4), 2.4+(1.8i), 1e-4 );
-  const std::vector<double>& entry_copy     = func.getEntryVector();
+  const std::vector<double>& entry_copy     = func.getEntryVector(); //generated
   const vector<complex<double>>& value_copy = func.getValueVector();
   assertIntEqual( entry_copy.size() , 3);
   assertIntEqual( value_copy.size() , 3);
@@ -145,14 +140,12 @@ void test_constant() {
 void test_segment() {
   vector<double> entry = {0, 1};
   vector<double> value = {1, 1};
-  double * entry_ptr = entry.data();
   double * value_ptr = value.data();
   ApproxFunction<double> func(move(entry), move(value), 0, 2);
   assertTrue( func.output(-0.0001) == 0 );
   assertTrue( func.output(0.0001) == 1 );
   assertTrue( func.output(0.9999) == 1 );
   assertTrue( func.output(1.0001) == 2);
-  assertTrue( func.getEntryVector().data() == entry_ptr );
   assertTrue( func.getValueVector().data() == value_ptr );
 }
 
@@ -167,23 +160,144 @@ void test_math_vector() {
   assertTrue( g0 == v1 );
 }
 
-DoubleApproxFunction return_copy(const DoubleApproxFunction& orig, const double ** entry_ptr, const double ** value_ptr) {
-  *entry_ptr = orig.getEntryVector().data();
+DoubleApproxFunction return_copy(const DoubleApproxFunction& orig, const double ** value_ptr) {
   *value_ptr = orig.getValueVector().data();
   return orig;
 }
 
 void test_func_copy() {
   DoubleApproxFunction f(4.4);
-  const double * entry_ptr;
   const double * value_ptr;
   DoubleApproxFunction * ptr = &f;
-  const DoubleApproxFunction& copy = return_copy(f, &entry_ptr, &value_ptr);
+  const DoubleApproxFunction& copy = return_copy(f, &value_ptr);
   assertTrue( &copy != ptr );
-  assertTrue( entry_ptr != copy.getEntryVector().data() );
   assertTrue( value_ptr != copy.getValueVector().data() );
 }
 
+//only the grid is stored, the entries are generated
+void test_grid() {
+  DoubleApproxFunction func({-1.0, -0.5, 0.0, 0.5, 1.0}, {0, 1, 4, 9, 16});
+  assertDoubleEqual( func.getFirstEntry(), -1.0, 1e-12 );
+  assertDoubleEqual( func.getLastEntry(), 1.0, 1e-12 );
+  vector<double> entry = {-1.0, -0.5, 0.0, 0.5, 1.0};
+  assertTrue( func.getEntryVector() == entry );
+  assertDoubleEqual( func.output(0.25), 6.5, 1e-12 );
+  assertDoubleEqual( func.output(0.5), 9, 1e-12 );
+  assertDoubleEqual( func.output(0.999999), 16, 1e-4 );
+
+  DoubleApproxFunction same(-1.0, 1.0, {0, 1, 4, 9, 16}, 0, 16);
+  assertTrue( same.getEntryVector() == entry );
+  for (double x = -1.2; x < 1.2; x += 0.01)
+    assertTrue( same.output(x) == func.output(x) );
+
+  assertThrow( DoubleApproxFunction(1.0, 1.0, {0, 1}, 0, 1), std::invalid_argument );
+  assertThrow( DoubleApproxFunction(0.0, 1.0, {0}, 0, 1), std::invalid_argument );
+}
+
+//batched and sorted evaluation equal the scalar output
+void test_output_into() {
+  DoubleApproxFunction func({-1.0, -0.5, 0.0, 0.5, 1.0}, {0, 1, 4, 9, 16}, -3, 20);
+  vector<double> input;
+  for (double x = -1.3; x < 1.3; x += 0.003)
+    input.push_back(x);
+  vector<double> output(input.size());
+
+  func.outputSortedInto(input, output);
+  for (size_t i = 0; i < input.size(); i++)
+    assertDoubleEqual( output[i], func.output(input[i]), 1e-12 );
+
+  for (size_t i = 0; i < input.size(); i += 7)
+    swap(input[i], input[input.size() - 1 - i]);
+  func.outputInto(input, output);
+  for (size_t i = 0; i < input.size(); i++)
+    assertTrue( output[i] == func.output(input[i]) );
+  assertTrue( func.outputVector(input) == output );
+
+  assertThrow( func.outputSortedInto(input, output), std::invalid_argument );
+  vector<double> small(3);
+  assertThrow( func.outputInto(input, small), std::invalid_argument );
+
+  ComplexApproxFunction complex_func({0.0, 1.0, 2.0}, {1.0 + 1.0i, 2.0, -1.0i});
+  vector<double> sorted = {-1.0, 0.0, 0.25, 0.5, 1.0, 1.75, 2.0, 3.0};
+  vector<complex<double>> complex_output(sorted.size());
+  complex_func.outputSortedInto(sorted, complex_output);
+  for (size_t i = 0; i < sorted.size(); i++)
+    assertComplexEqual( complex_output[i], complex_func.output(sorted[i]), 1e-12 );
+
+  DoubleApproxFunction constant(4.4);
+  output.resize(sorted.size());
+  constant.outputSortedInto(sorted, output);
+  for (double value : output)
+    assertDoubleEqual( value, 4.4, 1e-12 );
+}
+
+//tables built at compile time, with the output of the equal ApproxFunction
+void test_static() {
+  constexpr StaticApproxFunction<double, 3> hat(-1.0, 1.0, {0.0, 1.0, 0.0}, -1.0, -2.0);
+  static_assert( hat.output(0.5) == 0.5 );
+  static_assert( hat.output(-3.0) == -1.0 );
+  static_assert( hat.output(1.0) == -2.0 );
+  static_assert( sizeof(hat) <= 128 );
+
+  constexpr auto square = StaticApproxFunction<double, 101>::fromFunction(-1.0, 1.0, [](double x) { return x * x; }, 1.0, 1.0);
+  static_assert( square.getValues()[100] == 1.0 );
+  DoubleApproxFunction heap = square.toApproxFunction();
+  for (double x = -1.2; x < 1.2; x += 0.007)
+    assertDoubleEqual( square.output(x), heap.output(x), 1e-12 );
+  assertDoubleEqual( square.toApproxFunction(2.0).output(1.0), 0.25, 1e-12 );
+
+  constexpr auto phasor = StaticApproxFunction<complex<double>, 2>(0.0, 1.0, {1.0, 1.0i}, 0.0, 0.0);
+  assertComplexEqual( phasor.output(0.5), 0.5 + 0.5i, 1e-12 );
+
+  static_assert( constexprExp(0.0) == 1.0 );
+  for (double x = -20; x < 20; x += 0.37)
+    assertDoubleEqual( constexprExp(x), exp(x), 1e-13 );
+
+  assertThrow( (StaticApproxFunction<double, 2>(1.0, 1.0, {0.0, 1.0}, 0.0, 0.0)), std::invalid_argument );
+}
+
+//cubic interpolation is exact for quadratics between the inner entries
+void test_cubic() {
+  auto square = [](double x) { return x * x - 2 * x; };
+  DoubleApproxFunction func = DoubleApproxFunction::sample(square, -1.0, 3.0, 1e-3, Interpolation::Cubic, 0.0, 0.0);
+  assertTrue( func.getInterpolation() == Interpolation::Cubic );
+  double inner = func.getFirstEntry() + 4.0 / (func.getValueVector().size() - 1); //the second entry
+  for (double x = inner; x < 3.0 - (inner + 1.0); x += 0.01)
+    assertDoubleEqual( func.output(x), square(x), 1e-9 );
+  for (double x = -1.0; x < 3.0; x += 0.001)
+    assertTrue( fabs(func.output(x) - square(x)) <= 1e-3 );
+
+  vector<double> input = {-1.0, -0.3, 0.5, 2.9, 3.5};
+  vector<double> output(input.size());
+  func.outputSortedInto(input, output);
+  for (size_t i = 0; i < input.size(); i++)
+    assertTrue( output[i] == func.output(input[i]) );
+
+  //the same accuracy in far fewer values than linear interpolation
+  auto gauss = [](double x) { return exp(-4 * log(2.0) * x * x); };
+  auto linear = DoubleApproxFunction::sample(gauss, -2.0, 2.0, 1e-5, Interpolation::Linear, 0.0, 0.0);
+  auto cubic  = DoubleApproxFunction::sample(gauss, -2.0, 2.0, 1e-5, Interpolation::Cubic, 0.0, 0.0);
+  assertTrue( 4 * cubic.getValueVector().size() < linear.getValueVector().size() );
+  for (double x = -2.0; x < 2.0; x += 0.0007)
+    assertTrue( fabs(cubic.output(x) - gauss(x)) <= 1e-5 );
+
+  ComplexApproxFunction phasor = ComplexApproxFunction::sample([](double x) { return exp(1i * x); }, 0.0, 6.0, 1e-6, Interpolation::Cubic, 0.0, 0.0);
+  assertComplexEqual( phasor.output(1.0), exp(1i), 1e-5 );
+  VectorApproxFunction line = VectorApproxFunction::sample([](double x) { return math_vector{x, 2 * x, 0}; }, 0.0, 1.0, 1e-9, Interpolation::Cubic,
+                                                           math_vector{0, 0, 0}, math_vector{1, 2, 0});
+  assertIntEqual( line.getValueVector().size(), 5 );
+  assertTrue( math_vector_equal(line.output(0.3), math_vector{0.3, 0.6, 0}, 1e-12) );
+
+  constexpr auto static_cubic = StaticApproxFunction<double, 9>::fromFunction(-1.0, 3.0, square, 0.0, 0.0, Interpolation::Cubic);
+  static_assert( static_cubic.output(1.25) == 1.25 * 1.25 - 2 * 1.25 );
+  DoubleApproxFunction heap = static_cubic.toApproxFunction();
+  for (double x = -1.0; x < 3.0; x += 0.01)
+    assertDoubleEqual( static_cubic.output(x), heap.output(x), 1e-12 );
+
+  assertThrow( DoubleApproxFunction::sample(square, 1.0, 1.0, 1e-3, Interpolation::Cubic, 0.0, 0.0), std::invalid_argument );
+  assertThrow( DoubleApproxFunction::sample(square, 0.0, 1.0, 0.0, Interpolation::Cubic, 0.0, 0.0), std::invalid_argument );
+}
+
 void wrong_1() {
   std::vector<double> entry = {1.0};
   std::vector<double> value = {7.0};
@@ -218,6 +332,10 @@ int main() {
   test_constant();
   test_segment();
   test_math_vector();
+  test_grid();
+  test_output_into();
+  test_static();
+  test_cubic();
 
   assertThrow( wrong_1(), std::invalid_argument );
   assertThrow( wrong_2(), std::invalid_argument );
@@ -0,0 +1,69 @@
+#include <iostream>
+#include <cmath>
+#include <vector>
+#include <algorithm>
+
+#include <radsim/utils/timer.hpp>
+#include <radsim/utils/assert.hpp>
+
+#include <radsim/mathematics/approx_function.hpp>
+
+using namespace std;
+using namespace radsim;
+
+
+//ns per lookup, at pseudo random inputs over the table
+double timeLookups(const DoubleApproxFunction& func, const vector<double>& input, double& sum) {
+  int num_runs = 20;
+  Timer timer;
+  for (int run = 0; run < num_runs; run++)
+    for (double x : input)
+      sum += func.output(x);
+  return 1e9 * timer.elapsed() / (num_runs * input.size());
+}
+
+double maxError(const DoubleApproxFunction& func, double (*exact)(double)) {
+  double max_error = 0;
+  for (double x = -2.0; x < 2.0; x += 1e-4)
+    max_error = max(max_error, fabs(func.output(x) - exact(x)));
+  return max_error;
+}
+
+double gauss(double x) {
+  return exp(-4 * log(2.0) * x * x); //the Gaussian beam pattern, in beamwidths
+}
+
+
+//Lookup throughput and error of linear and cubic tables sized to the same error bound.
+//The cubic table must be several times smaller, and each lookup only a small factor slower.
+int main(int argc, char ** argv) {
+  vector<double> input(100000);
+  for (size_t n = 0; n < input.size(); n++)
+    input[n] = -2.0 + 4.0 * ((n * 7919) % input.size()) / input.size();
+
+  for (double max_error : {1e-4, 1e-5, 1e-6}) {
+    auto linear = DoubleApproxFunction::sample(gauss, -2.0, 2.0, max_error, Interpolation::Linear, 0.0, 0.0);
+    auto cubic  = DoubleApproxFunction::sample(gauss, -2.0, 2.0, max_error, Interpolation::Cubic, 0.0, 0.0);
+
+    //best of a few alternating runs, to be less sensitive to other load on the machine
+    double sum = 0;
+    double time_linear = 1e9; //ns
+    double time_cubic = 1e9; //ns
+    for (int run = 0; run < 3; run++) {
+      time_linear = min(time_linear, timeLookups(linear, input, sum));
+      time_cubic = min(time_cubic, timeLookups(cubic, input, sum));
+    }
+
+    cout << "max error " << max_error << endl;
+    cout << "  linear: " << linear.getValueVector().size() << " values, error " << maxError(linear, gauss)
+         << ", " << time_linear << " ns per lookup" << endl;
+    cout << "  cubic : " << cubic.getValueVector().size() << " values, error " << maxError(cubic, gauss)
+         << ", " << time_cubic << " ns per lookup" << endl;
+
+    assertTrue( 4 * cubic.getValueVector().size() < linear.getValueVector().size() );
+    assertTrue( maxError(cubic, gauss) <= max_error );
+    assertTrue( time_cubic < 4 * time_linear );
+    assertTrue( sum != 0 );
+  }
+  return 0;
+}
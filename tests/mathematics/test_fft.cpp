@@ -0,0 +1,152 @@
+#include <math.h>
+
+#include <iostream>
+#include <vector>
+#include <complex>
+
+#include <radsim/utils/assert.hpp>
+
+#include <radsim/mathematics/constants.hpp>
+#include <radsim/mathematics/fft.hpp>
+
+using namespace std;
+using namespace radsim;
+
+
+//compares with a direct evaluation of the DFT sum
+void test_against_dft() {
+  size_t N = 64;
+  vector<complex<double>> x(N);
+  for (size_t n = 0; n < N; n++)
+    x[n] = complex<double>( cos(0.3 * n) + 0.1 * n, sin(1.7 * n) );
+
+  vector<complex<double>> X = x;
+  fft(X);
+  for (size_t k = 0; k < N; k++) {
+    complex<double> sum = 0;
+    for (size_t n = 0; n < N; n++)
+      sum += x[n] * exp( complex<double>(0, -2 * pi * k * n / N) );
+    assertComplexEqual( X[k], sum, 1e-9 );
+  }
+
+  fft(X, true);
+  for (size_t n = 0; n < N; n++)
+    assertComplexEqual( X[n], x[n], 1e-9 );
+}
+
+
+//a complex exponential at bin k0 ends up in bin k0 only
+void test_single_tone() {
+  size_t N = 256;
+  int k0 = 13;
+  vector<complex<double>> x(N);
+  for (size_t n = 0; n < N; n++)
+    x[n] = exp( complex<double>(0, 2 * pi * k0 * n / N) );
+
+  fft(x);
+  assertComplexEqual( x[k0], (double) N, 1e-9 );
+  assertTrue( abs(x[k0 + 1]) < 1e-9 );
+  assertTrue( abs(x[0]) < 1e-9 );
+
+  vector<complex<double>> single = {2.0};
+  fft(single);
+  assertComplexEqual( single[0], 2.0, 1e-12 );
+}
+
+
+//a plan gives the same result as the plain transform, and can be reused
+void test_plan() {
+  size_t N = 128;
+  FFTPlan plan(N);
+  assertIntEqual( plan.size(), N );
+  for (int loop = 0; loop < 2; loop++) {
+    vector<complex<double>> x(N);
+    for (size_t n = 0; n < N; n++)
+      x[n] = complex<double>( sin(0.1 * n * (loop + 1)), cos(0.37 * n) );
+    vector<complex<double>> y = x;
+    plan.execute(x.data());
+    fft(y);
+    for (size_t k = 0; k < N; k++)
+      assertComplexEqual( x[k], y[k], 1e-12 );
+  }
+
+  assertIntEqual( nextPowerOfTwo(1), 1 );
+  assertIntEqual( nextPowerOfTwo(100), 128 );
+  assertIntEqual( nextPowerOfTwo(128), 128 );
+}
+
+
+//sizes that are not powers of 2, including primes
+void test_mixed_radix() {
+  for (size_t N : {3, 6, 12, 15, 30, 49, 60, 97, 1000}) {
+    vector<complex<double>> x(N);
+    for (size_t n = 0; n < N; n++)
+      x[n] = complex<double>( cos(0.3 * n) + 0.1 * n, sin(1.7 * n) );
+
+    vector<complex<double>> X = x;
+    fft(X);
+    for (size_t k = 0; k < N; k += 1 + N / 50) {
+      complex<double> sum = 0;
+      for (size_t n = 0; n < N; n++)
+        sum += x[n] * exp( complex<double>(0, -2 * pi * k * n / N) );
+      assertComplexEqual( X[k], sum, 1e-8 );
+    }
+
+    fft(X, true);
+    for (size_t n = 0; n < N; n++)
+      assertComplexEqual( X[n], x[n], 1e-9 );
+  }
+}
+
+
+//the real transform gives the non-negative frequencies of the complex transform
+void test_real() {
+  for (size_t N : {2, 8, 30, 256}) {
+    vector<double> x(N);
+    vector<complex<double>> y(N);
+    for (size_t n = 0; n < N; n++) {
+      x[n] = sin(0.4 * n) + 0.05 * n;
+      y[n] = x[n];
+    }
+    fft(y);
+    vector<complex<double>> X = rfft(x);
+    assertIntEqual( X.size(), N / 2 + 1 );
+    for (size_t k = 0; k <= N / 2; k++)
+      assertComplexEqual( X[k], y[k], 1e-9 );
+  }
+}
+
+
+//plans are built once per size
+void test_cached_plans() {
+  auto plan = FFTPlan::get(48);
+  assertTrue( FFTPlan::get(48) == plan );
+  assertIntEqual( plan->size(), 48 );
+  assertTrue( RealFFTPlan::get(48) == RealFFTPlan::get(48) );
+  assertIntEqual( RealFFTPlan::get(48)->size(), 48 );
+}
+
+
+void wrong_size() {
+  vector<complex<double>> x(0);
+  fft(x);
+}
+
+
+int main() {
+  test_against_dft();
+  test_single_tone();
+  test_plan();
+  test_mixed_radix();
+  test_real();
+  test_cached_plans();
+
+  assertTrue( isPowerOfTwo(1) );
+  assertTrue( isPowerOfTwo(1024) );
+  assertFalse( isPowerOfTwo(0) );
+  assertFalse( isPowerOfTwo(12) );
+  assertThrow( wrong_size(), invalid_argument );
+  assertThrow( FFTPlan(0), invalid_argument );
+  assertThrow( RealFFTPlan(15), invalid_argument );
+  return 0;
+}
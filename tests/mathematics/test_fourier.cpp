@@ -61,10 +61,92 @@ void test_fourier_from_table_const_function() {
 }
 
 
+//the FFT version gives the values of the direct sum, for real and complex functions
+void test_fast_fourier() {
+  size_t N = 300;
+  double dt = 0.02;
+  double t_start = -3.0;
+  std::vector<double> t_entry(N);
+  std::vector<double> real_value(N);
+  std::vector<std::complex<double>> complex_value(N);
+  for (size_t n = 0; n < N; n++) {
+    t_entry[n] = t_start + n * dt;
+    real_value[n] = exp(-(t_entry[n] - 0.4) * (t_entry[n] - 0.4));
+    complex_value[n] = real_value[n] * exp(3.0i * t_entry[n]);
+  }
+  DoubleApproxFunction G_real(t_entry, real_value);
+  ComplexApproxFunction G_complex(t_entry, complex_value);
+
+  for (bool inverse : {false, true}) {
+    ComplexApproxFunction F_real = fastFourierTransform(G_real, N, dt, t_start, inverse);
+    ComplexApproxFunction F_complex = fastFourierTransform(G_complex, N, dt, t_start, inverse);
+    const auto& f_entry = F_real.getEntryVector();
+    assertIntEqual( f_entry.size(), N );
+    assertDoubleEqual( f_entry[0], -0.5 / dt, 1e-9 );
+    assertDoubleEqual( f_entry[1] - f_entry[0], 1 / (N * dt), 1e-9 );
+
+    for (size_t k = 0; k < N; k += 7) {
+      double f = f_entry[k];
+      double t_end = t_start + (N - 0.5) * dt;
+      assertComplexEqual( F_real.getValueVector()[k], fourierTransformSingle(G_real, f, dt, t_start, t_end, inverse), 1e-9 );
+      assertComplexEqual( F_complex.getValueVector()[k], fourierTransformSingle(G_complex, f, dt, t_start, t_end, inverse), 1e-9 );
+    }
+  }
+}
+
+
+//the phasor recurrence gives the direct sum over exp, on an irregular frequency grid
+template <class T>
+std::complex<double> directSum(const ApproxFunction<T>& G, double f, double dt, double t_start, double t_end, bool Inverse) {
+  std::complex<double> F = 0;
+  double Sign = Inverse ? 1 : -1;
+  for (double t = t_start; t < t_end; t += dt)
+    F += G.output(t) * exp(Sign * 2 * pi * 1i * t * f);
+  return F * dt;
+}
+
+void test_phasor_recurrence() {
+  size_t N = 2000;
+  double dt = 1e-3;
+  double t_start = -1.0;
+  double t_end = t_start + N * dt;
+  std::vector<double> t_entry(N);
+  std::vector<double> real_value(N);
+  std::vector<std::complex<double>> complex_value(N);
+  for (size_t n = 0; n < N; n++) {
+    t_entry[n] = t_start + n * dt;
+    real_value[n] = 1.0 + 0.5 * cos(7 * t_entry[n]);
+    complex_value[n] = real_value[n] * exp(40.0i * t_entry[n]);
+  }
+  DoubleApproxFunction G_real(t_entry, real_value);
+  ComplexApproxFunction G_complex(t_entry, complex_value);
+
+  std::vector<double> f_entry;
+  for (int n = 0; n < 37; n++)
+    f_entry.push_back(-450 + 25.3 * n + 0.7 * n * n); //hz, irregular
+  f_entry.push_back(0.0);
+
+  ThreadPool pool(2);
+  for (bool inverse : {false, true}) {
+    std::vector<std::complex<double>> F_real = nonUniformFourierTransform(G_real, f_entry, dt, t_start, t_end, inverse);
+    std::vector<std::complex<double>> F_complex = nonUniformFourierTransform(G_complex, f_entry, dt, t_start, t_end, inverse, &pool);
+    for (size_t k = 0; k < f_entry.size(); k++) {
+      double f = f_entry[k];
+      std::complex<double> real_ref = directSum(G_real, f, dt, t_start, t_end, inverse);
+      std::complex<double> complex_ref = directSum(G_complex, f, dt, t_start, t_end, inverse);
+      assertTrue( abs(F_real[k] - real_ref) <= 1e-10 * std::max(abs(real_ref), 1e-3) );
+      assertTrue( abs(F_complex[k] - complex_ref) <= 1e-10 * std::max(abs(complex_ref), 1e-3) );
+      assertTrue( abs(fourierTransformSingle(G_real, f, dt, t_start, t_end, inverse) - F_real[k]) < 1e-15 );
+    }
+  }
+}
+
 
 int main() {
   test_fourier_from_table();
   test_fourier_from_table_const_function();
+  test_fast_fourier();
+  test_phasor_recurrence();
   
   return 0;
 }
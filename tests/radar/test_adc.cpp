@@ -29,6 +29,18 @@ void test_adc_log_mode() {
   assertIntEqual( adc.convertSignal(min_level * 5) , 177 );
 }
 
+void test_adc_amplitude() {
+  double min_level  = 1e-14; //W
+  int    resolution = 10; //bits
+  ADC adc(resolution, ADCMode::Power, min_level); 
+  double max_amplitude = sqrt(min_level * 1023); //amp
+  assertIntEqual( adc.convertAmplitude(0), 0 );
+  assertIntEqual( adc.convertAmplitude(2 * max_amplitude), 511 );
+  assertIntEqual( adc.convertAmplitude(-2 * max_amplitude), -511 );
+  assertIntEqual( adc.convertAmplitude(0.5001 * max_amplitude), 255 );
+  assertIntEqual( adc.convertAmplitude(-0.5001 * max_amplitude), -255 );
+}
+
 void wrong_1() {
   ADC(10, ADCMode::Logarithm, 12.0);
 }
@@ -50,6 +62,7 @@ void test_wrong_inputs() {
 int main() {
   test_adc_effect_mode();
   test_adc_log_mode();
+  test_adc_amplitude();
   test_wrong_inputs();
    
   return 0;
@@ -6,6 +6,7 @@
 
 #include <radsim/radar/beam_pattern.hpp>
 
+using namespace std;
 using namespace radsim;
 
 void test() {
@@ -17,7 +18,26 @@ void test() {
 }
 
 
+//the compile time tables scaled to the beamwidth
+void test_beam_shape() {
+  double beamwidth = 0.03; //rad
+  for (BeamPattern pattern : {BeamPattern::Triangular, BeamPattern::Gaussian}) {
+    auto f = createBeamPattern(pattern, beamwidth);
+    BeamShape shape(pattern, beamwidth);
+    for (double x = -0.07; x < 0.07; x += 0.0003)
+      assertDoubleEqual( shape.output(x), f.output(x), 1e-9 );
+  }
+  BeamShape triangular(BeamPattern::Triangular, 2.0);
+  assertDoubleEqual( triangular.output(1.0), 0.5, 1e-12 );
+  assertDoubleEqual( triangular.output(3.0), 0.0, 1e-12 );
+  assertDoubleEqual( BeamShape(BeamPattern::Gaussian, 2.0).output(1.0), 0.5, 1e-3 );
+
+  assertThrow( BeamShape(BeamPattern::Gaussian, 0.0), std::invalid_argument );
+}
+
+
 int main() {
   test();
+  test_beam_shape();
   return 0;
 }
@@ -0,0 +1,137 @@
+#include <math.h>
+
+#include <vector>
+
+#include <radsim/utils/assert.hpp>
+
+#include <radsim/mathematics/constants.hpp>
+#include <radsim/mathematics/mathutils.hpp>
+
+#include <radsim/radar/radar_config.hpp>
+#include <radsim/radar/radar_config_parser.hpp>
+#include <radsim/radar/radar.hpp>
+#include <radsim/radar/clutter_map.hpp>
+
+using namespace std;
+using namespace radsim;
+
+
+//the texture has mean 1 and variance 1 / shape, and is generated once per cell
+void test_texture() {
+  int num_bins = 20000;
+  double shape = 2.0;
+  ClutterMap map(10 * pi / 180.0, num_bins, shape, 7);
+  assertIntEqual( map.getNumCells(), 36 );
+  assertIntEqual( map.getNumCachedCells(), 0 );
+  assertIntEqual( map.findCell(15 * pi / 180.0), 1 );
+  assertIntEqual( map.findCell(-5 * pi / 180.0), 35 );
+
+  const float * texture = map.getTexture(3);
+  assertIntEqual( map.getNumCachedCells(), 1 );
+  double sum = 0, sum2 = 0;
+  for (int n = 0; n < num_bins; n++) {
+    sum += texture[n];
+    sum2 += texture[n] * texture[n];
+  }
+  double mean = sum / num_bins;
+  double variance = sum2 / num_bins - mean * mean;
+  assertDoubleEqual( mean, 1.0, 3e-2 );
+  assertDoubleEqual( variance, 1 / shape, 1e-1 );
+
+  //cached, and independent of the order cells are visited in
+  assertTrue( map.getTexture(3) == texture );
+  float first = texture[0];
+  ClutterMap other(10 * pi / 180.0, num_bins, shape, 7);
+  other.getTexture(5);
+  assertTrue( other.getTexture(3)[0] == first );
+
+  map.setSeed(8);
+  assertIntEqual( map.getNumCachedCells(), 0 );
+  assertFalse( map.getTexture(3)[0] == first );
+}
+
+
+RadarConfig seaConfig(RadarConfig config, double sigma0 = -30) {
+  config.setClutterType(ClutterType::Sea);
+  config.setClutterSigma0(sigma0);
+  config.setClutterShape(1.0);
+  return config;
+}
+
+
+//with no pdf, the clutter is the mean clutter power times the texture, and the texture is 
+//the same every time the antenna points in the same direction
+void test_radar_clutter(const RadarConfig& config) {
+  Radar plain(config);
+  assertTrue( plain.getClutterType() == ClutterType::None );
+  plain.setToAddNoise(false);
+  PulseData pulse = plain.generatePulseData();
+  for (auto sample : pulse.registry)
+    assertIntEqual( sample, 0 );
+
+  Radar radar( seaConfig(config) );
+  assertTrue( radar.getClutterType() == ClutterType::Sea );
+  radar.setToAddNoise(false);
+  radar.setUsePdf(false);
+  radar.setAntRotSpeed(0);
+  assertTrue( radar.getMeanClutterPower(10) > radar.getMeanClutterPower(100) ); //R^-3
+  assertDoubleEqual( radar.getMeanClutterPower(10) / radar.getMeanClutterPower(20), 
+                     pow(radar.getRange(20) / radar.getRange(10), 3), 1e-6 );
+
+  PulseData pulse0 = radar.generatePulseData();
+  PulseData pulse1 = radar.generatePulseData();
+  int num_clutter_bins = 0;
+  for (size_t n = 0; n < pulse0.registry.size(); n++) {
+    assertIntEqual( pulse0.registry[n], pulse1.registry[n] );
+    if (pulse0.registry[n] > 0)
+      num_clutter_bins++;
+  }
+  assertTrue( num_clutter_bins > 10 );
+
+  radar.setToAddClutter(false);
+  pulse = radar.generatePulseData();
+  assertIntEqual( pulse.registry[0], 0 );
+}
+
+
+//speckle averages out over many pulses, the texture does not
+void test_speckle(const RadarConfig& config) {
+  Radar radar( seaConfig(config, -60) ); //below ADC saturation
+  radar.setRandomParameters(true, 3, NULL);
+  radar.setToAddNoise(false);
+  radar.setAntRotSpeed(0);
+  int num_pulses = 400;
+  int bin = 150;
+  vector<double> power(num_pulses);
+  for (int p = 0; p < num_pulses; p++) {
+    IQPulseData pulse = radar.generateIQPulseData();
+    double I = pulse.registry[2 * bin];
+    double Q = pulse.registry[2 * bin + 1];
+    power[p] = I * I + Q * Q;
+  }
+  double mean = 0;
+  for (double value : power)
+    mean += value / num_pulses;
+  double variance = 0;
+  for (double value : power)
+    variance += (value - mean) * (value - mean) / num_pulses;
+  assertTrue( mean > 0 );
+  assertDoubleEqual( sqrt(variance), mean, 0.2 ); //exponential power for a fixed texture
+}
+
+
+int main(int argc , char ** argv) {
+
+  test_texture();
+
+  const string config_file = string(argv[1]) + "/radar_configs/short_range_radar.txt";
+  RadarConfig config = RadarConfigParser().parseFile(config_file);
+  test_radar_clutter(config);
+  test_speckle(config);
+
+  assertThrow( ClutterMap(0, 10, 1.0), invalid_argument );
+  assertThrow( ClutterMap(0.1, 10, 0), invalid_argument );
+  assertThrow( ClutterMap(0.1, 10, 1.0).getTexture(100), invalid_argument );
+  assertThrow( config.setClutterShape(-1), invalid_argument );
+  return 0;
+}
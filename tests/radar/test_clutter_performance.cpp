@@ -0,0 +1,46 @@
+#include <algorithm>
+
+#include <radsim/utils/timer.hpp>
+#include <radsim/utils/assert.hpp>
+
+#include <radsim/radar/radar_config.hpp>
+#include <radsim/radar/radar_config_parser.hpp>
+#include <radsim/radar/radar.hpp>
+
+using namespace std;
+using namespace radsim;
+
+
+//s, time per pulse over a full antenna rotation
+double timePulses(const RadarConfig& config) {
+  Radar radar(config);
+  int num_pulses = 1000; //a full rotation of the naval radar
+  Timer timer;
+  for (int n = 0; n < num_pulses; n++)
+    radar.generatePulseData();
+  return timer.elapsed() / num_pulses;
+}
+
+
+//Only the speckle is drawn per pulse, the texture is cached. Simulation with clutter
+//must stay within a small factor of the cost without clutter, also in the first scan.
+int main(int argc , char ** argv) {
+
+  const string config_file = string(argv[1]) + "/radar_configs/naval_radar.txt";
+  RadarConfig config = RadarConfigParser().parseFile(config_file);
+  RadarConfig sea_config = config;
+  sea_config.setClutterType(ClutterType::Sea);
+
+  //best of a few alternating runs, to be less sensitive to other load on the machine
+  double time_plain = 1e9; //s
+  double time_clutter = 1e9; //s
+  for (int run = 0; run < 3; run++) {
+    time_plain = min(time_plain, timePulses(config));
+    time_clutter = min(time_clutter, timePulses(sea_config));
+  }
+
+  cout << "Time per pulse without clutter (ms): " << 1e3 * time_plain << endl;
+  cout << "Time per pulse with clutter (ms)   : " << 1e3 * time_clutter << endl;
+  assertTrue( time_clutter < 4 * time_plain );
+  return 0;
+}
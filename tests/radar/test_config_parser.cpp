@@ -1,3 +1,4 @@
+#include <math.h>
 #include <iostream>
 
 #include <radsim/utils/assert.hpp>
@@ -35,6 +36,8 @@ void test_parse_string() {
                         1e-4 );
   assertComplexEqual( config.getMaximumReceiveTime(), 1.5e-3, 1e-4 );
   assertComplexEqual( config.getTheta(), 0.5 * pi, 1e-4 );
+  assertTrue( config.getClutterType() == ClutterType::None );
+  assertDoubleEqual( config.getClutterSigma0(), 0, 1e-6 );
 }
 
 void test_parse_optional_params() {
@@ -99,10 +102,29 @@ void test_parse_missing_keyword() {
   ADCResolution    1024 #integer
   ADCMode          Power
   ADCMax2Noise     20.0 #unit
+  Waveform         LFM
+  ChirpBandWidth   4.0 #Mhz
+  ClutterType      Land
+  ClutterSigma0    -25.0 #db
+  ClutterShape     3.0 #unit
   )"};
   RadarConfigParser parser;
   auto config = parser.parseString(config_str);
   config.assertParametersSet();
+  assertTrue( config.getWaveform() == Waveform::LFM );
+  assertDoubleEqual( config.getChirpBandWidth(), 4e6, 1e-6 );
+  assertTrue( config.getClutterType() == ClutterType::Land );
+  assertDoubleEqual( config.getClutterSigma0(), pow(10, -2.5), 1e-6 );
+  assertDoubleEqual( config.getClutterShape(), 3.0, 1e-6 );
+}
+
+//note: unknown waveform
+void test_parse_wrong_waveform() {
+  const string config_str = string { R"(
+  Waveform         Barker
+  )"};
+  RadarConfigParser parser;
+  RadarConfig config = parser.parseString(config_str);
 }
 
 //note: Bandwidth not set
@@ -168,6 +190,22 @@ void test_parse_file(const string& config_file) {
   config.assertParametersSet();
 }
 
+//keywords set in file units
+void test_set_keyword(const string& config_file) {
+  RadarConfigParser parser;
+  RadarConfig config = parser.parseFile(config_file);
+  parser.setKeyword(config, "PulseWidth", 0.5);
+  parser.setKeyword(config, "ADCResolution", 12);
+  parser.setKeyword(config, "NoiseFigure", 10);
+  assertDoubleEqual( config.getPulseWidth(), 0.5e-6, 1e-9 );
+  assertIntEqual( config.getADCResolution(), 12 );
+  assertDoubleEqual( config.getNoiseFigure(), 10, 1e-9 );
+
+  assertThrow( parser.setKeyword(config, "ADCResolution", 12.5), invalid_argument );
+  assertThrow( parser.setKeyword(config, "ADCMode", 1), invalid_argument );
+  assertThrow( parser.setKeyword(config, "Bla", 1), invalid_argument );
+}
+
 void parse_wrong_file() {
   RadarConfigParser parser;
   parser.parseFile("bad_file");  
@@ -180,6 +218,7 @@ int main(int argc , char ** argv) {
   test_parse_optional_params();
   const string filename = string(argv[1]) + "/radar_configs/short_range_radar.txt";
   test_parse_file( filename );
+  test_set_keyword( filename );
   
   assertThrow(parse_wrong_file(), invalid_argument);
   assertThrow(test_parse_double_as_integer(), logic_error);
@@ -189,5 +228,6 @@ int main(int argc , char ** argv) {
   assertThrow(test_parse_wrong_keyword_structure_c(), invalid_argument);
   assertThrow(test_repetition(), invalid_argument);
   assertThrow(test_text_not_commented(), invalid_argument);
+  assertThrow(test_parse_wrong_waveform(), invalid_argument);
   return 0;
 }
@@ -0,0 +1,80 @@
+#include <vector>
+#include <string>
+#include <stdexcept>
+
+#include <mpi.h>
+
+#include <radsim/utils/assert.hpp>
+
+#include <radsim/radar/radar_config.hpp>
+#include <radsim/radar/radar_config_parser.hpp>
+#include <radsim/radar/radar.hpp>
+#include <radsim/radar/monte_carlo.hpp>
+#include <radsim/radar/parameter_sweep.hpp>
+#include <radsim/radar/distributed.hpp>
+
+using namespace std;
+using namespace radsim;
+
+
+DetectionCount countCrossings(const PulseData& pulse_data, size_t trial) {
+  unsigned long crossings = 0;
+  for (unsigned short level : pulse_data.registry)
+    if (level >= 128)
+      crossings++;
+  return DetectionCount(crossings, pulse_data.registry.size());
+}
+
+
+//the distributed result equals the result of one process running all trials
+void test_monte_carlo(const RadarConfig& config) {
+  auto empty = [](size_t trial) { return TargetCollection(); };
+  MonteCarloRunner runner(config, 11, 0);
+
+  MonteCarloResult result = runDistributed<unsigned short>(runner, 101, empty, countCrossings);
+  MonteCarloResult reference = runner.run(101, empty, countCrossings);
+  assertIntEqual( result.getNumTrials(), 101 );
+  assertIntEqual( result.getNumDetections(), reference.getNumDetections() );
+  assertIntEqual( result.getNumOpportunities(), reference.getNumOpportunities() );
+}
+
+
+void test_sweep(const RadarConfig& config) {
+  ParameterSweep sweep(config, 0);
+  sweep.addAxis("NoiseFigure", {2, 4, 6, 8, 10});
+  auto metric = [](Radar& radar, size_t point) { return vector<double>{ radar.getAvgNoise(), (double) point }; };
+
+  SweepTable table = runDistributed(sweep, metric, {"AvgNoise", "Point"});
+  SweepTable reference = sweep.run(metric, {"AvgNoise", "Point"});
+  assertIntEqual( table.getNumRows(), 5 );
+  assertTrue( table.getColumnNames() == reference.getColumnNames() );
+  for (size_t n = 0; n < table.getNumColumns(); n++)
+    assertTrue( table.getColumn(n) == reference.getColumn(n) );
+}
+
+
+//a failing point throws on every rank
+void failing_sweep(const RadarConfig& config) {
+  ParameterSweep sweep(config, 0);
+  sweep.addAxis("NoiseFigure", {2, 4, 6, 8, 10});
+  runDistributed(sweep, [](Radar& radar, size_t point) {
+    if (point == 4)
+      throw invalid_argument("bad point");
+    return vector<double>{ 1.0 };
+  }, {"a"});
+}
+
+
+int main(int argc, char** argv) {
+  MPI_Init(&argc, &argv);
+
+  string config_dir = string(argv[1]) + "/radar_configs";
+  RadarConfig config = RadarConfigParser().parseFile(config_dir + "/short_range_radar.txt");
+
+  test_monte_carlo(config);
+  test_sweep(config);
+  assertThrow( failing_sweep(config), exception );
+
+  MPI_Finalize();
+  return 0;
+}
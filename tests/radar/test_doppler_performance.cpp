@@ -0,0 +1,48 @@
+#include <vector>
+#include <cstdlib>
+
+#include <radsim/utils/timer.hpp>
+#include <radsim/utils/assert.hpp>
+
+#include <radsim/radar/pulse_data.hpp>
+#include <radsim/radar/doppler_processor.hpp>
+
+using namespace std;
+using namespace radsim;
+
+
+//Throughput of the CPI stage for typical CPI lengths, with the range bins of the naval radar.
+//The processing of a CPI must take less time than the CPI itself, M * PRT.
+void run_cpi(int M) {
+  int num_bins = 1600;
+  double prt = 2e-3; //s
+  int num_cpi = 4;
+
+  vector<IQPulseData> pulses;
+  for (int n = 0; n < M; n++) {
+    vector<short> registry(2 * num_bins);
+    for (auto& sample : registry)
+      sample = rand() % 1024 - 512;
+    pulses.emplace_back(n * prt, (math_vector){1, 0, 0}, move(registry));
+  }
+
+  DopplerProcessor processor(M, num_bins, prt);
+  Timer timer;
+  for (int cpi = 0; cpi < num_cpi; cpi++) {
+    for (const auto& pulse : pulses)
+      processor.add(pulse);
+    processor.getMap();
+  }
+  double time_per_cpi = timer.elapsed() / num_cpi; //s
+
+  cout << "M = " << M << ", time per CPI (ms): " << 1e3 * time_per_cpi 
+       << ", pulses/s: " << M / time_per_cpi << ", CPI duration (ms): " << 1e3 * M * prt << endl;
+  assertTrue( time_per_cpi < M * prt );
+}
+
+
+int main(int argc , char ** argv) {
+  for (int M = 16; M <= 256; M *= 2)
+    run_cpi(M);
+  return 0;
+}
@@ -0,0 +1,107 @@
+#include <math.h>
+
+#include <vector>
+
+#include <radsim/utils/assert.hpp>
+
+#include <radsim/mathematics/constants.hpp>
+#include <radsim/mathematics/math_vector.hpp>
+#include <radsim/mathematics/mathutils.hpp>
+
+#include <radsim/radar/radar_config.hpp>
+#include <radsim/radar/radar_config_parser.hpp>
+#include <radsim/radar/radar.hpp>
+#include <radsim/radar/doppler_processor.hpp>
+
+using namespace std;
+using namespace radsim;
+
+
+//A target closing in with radial speed v has doppler frequency 2v / wavelength. The speed 
+//is chosen so that the doppler frequency is exactly on doppler bin k0.
+void test_moving_target(const RadarConfig& config) {
+  Radar radar(config);
+  radar.setToAddClutter(false);
+  radar.setToAddNoise(false);
+  double T = radar.getPRT(); //s
+  double wavelength = radar.getCarrierWavelength(); //m
+  int num_bins = radar.getNumRangeBins();
+
+  int M = 32;
+  int k0 = 3;
+  double f_doppler = k0 / (M * T); //hz
+  double v = f_doppler * wavelength / 2; //m/s, closing speed
+
+  int bin_index = 253;
+  double distance = radar.getRange(bin_index); //m
+  double t_max = 2 * M * T; //s
+  TargetCollection targets;
+  targets.emplace_back( VectorApproxFunction( {0, t_max}, { {distance, 0, 0}, {distance - v * t_max, 0, 0} } ), 1.0 );
+
+  DopplerProcessor processor(M, num_bins, T, 2);
+  assertIntEqual( processor.getNumPulses(), M );
+  for (int n = 0; n < M - 1; n++)
+    assertFalse( processor.add( radar.generateIQPulseData(targets, true, 40 * radar.getAvgNoise()) ) );
+  assertTrue( processor.add( radar.generateIQPulseData(targets, true, 40 * radar.getAvgNoise()) ) );
+
+  RangeDopplerMap map = processor.getMap();
+  assertFalse( processor.ready() );
+  assertIntEqual( map.getNumRangeBins(), num_bins );
+  assertIntEqual( map.getNumDopplerBins(), M );
+  assertDoubleEqual( map.getEndTime(), (M - 1) * T, 1e-6 );
+  assertIntEqual( map.findPeakDopplerBin(bin_index), k0 );
+  assertDoubleEqual( map.getDopplerFrequency(k0), f_doppler, 1e-6 );
+  assertDoubleEqual( map.getDopplerFrequency(M - 1), - 1 / (M * T), 1e-6 );
+  assertTrue( map.getPower(bin_index, k0) > 100 * map.getPower(bin_index, k0 + 4) );
+  assertDoubleEqual( map.getPower(100, k0), 0, 1e-6 );
+
+  //stationary target => zero doppler
+  radar.reset();
+  processor.reset();
+  targets.clear();
+  targets.emplace_back( (math_vector){distance, 0, 0}, 1.0 );
+  for (int n = 0; n < M; n++)
+    processor.add( radar.generateIQPulseData(targets, true, 40 * radar.getAvgNoise()) );
+  assertIntEqual( processor.getMap().findPeakDopplerBin(bin_index), 0 );
+}
+
+
+//pulses are read directly from the simulation queue
+void test_consume(const RadarConfig& config) {
+  double dt = 0.01; //s
+  IQRadarInterface com(config, {}, dt);
+  DopplerProcessor processor(16, com.getNumRangeBins(), com.getPRT(), 2);
+  com.start();
+  while (com.getSimTime() < dt) {
+  }
+  com.stop();
+  assertTrue( processor.consume(com) );
+  assertFalse( com.dataReady() );
+  RangeDopplerMap map = processor.getMap();
+  assertIntEqual( map.getNumDopplerBins(), 16 );
+  assertDoubleEqual( map.getEndTime() - map.getStartTime(), 15 * com.getPRT(), 1e-6 );
+}
+
+
+void wrong_size(const RadarConfig& config) {
+  Radar radar(config);
+  DopplerProcessor processor(16, radar.getNumRangeBins() + 1, radar.getPRT(), 0);
+  processor.add( radar.generateIQPulseData() );
+}
+
+
+int main(int argc , char ** argv) {
+
+  const string config_file = string(argv[1]) + "/radar_configs/short_range_radar.txt";
+  RadarConfig config = RadarConfigParser().parseFile(config_file);
+  test_moving_target(config);
+  test_consume(config);
+
+  assertThrow( wrong_size(config), invalid_argument );
+  assertThrow( DopplerProcessor(24, 100, 1e-3, 0), invalid_argument );
+  assertThrow( DopplerProcessor(0, 100, 1e-3, 0), invalid_argument );
+  assertThrow( DopplerProcessor(-16, 100, 1e-3, 0), invalid_argument );
+  assertThrow( DopplerProcessor(16, 0, 1e-3, 0), invalid_argument );
+  assertThrow( DopplerProcessor(16, 100, 1e-3, 0).getMap(), logic_error );
+  return 0;
+}
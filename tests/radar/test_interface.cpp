@@ -3,6 +3,7 @@
 #include <vector>
 #include <memory>
 #include <exception>
+#include <ctime>
 
 #include <radsim/utils/assert.hpp>
 #include <radsim/utils/timer.hpp>
@@ -189,6 +190,142 @@ void run_reset() {
 }
 
 
+//integrated records of 10 pulses each are queued instead of the pulses
+void run_integration() {
+  RadarInterface com(config, {}, 0.02);
+  com.setIntegration(IntegrationMode::Count, 10);
+  double max_time = 0.1;
+
+  com.start();
+  while (com.getSimTime() < max_time) {
+  }
+  com.stop();
+
+  assertFalse( com.dataReady() );
+  assertTrue( com.integratedDataReady() );
+
+  double prt = config.getPRT(); //s
+  double t_start = -1;
+  while (com.integratedDataReady()) {
+    auto data = com.getIntegratedData();
+    assertIntEqual( data.getNumPulses(), 10 );
+    assertDoubleEqual( data.getEndTime() - data.getStartTime(), 9 * prt, 1e-4 );
+    if (t_start >= 0) 
+      assertDoubleEqual( data.getStartTime() - t_start, 10 * prt, 1e-4 );
+    t_start = data.getStartTime();
+    com.recycleIntegrated( move(data) );
+  }
+
+  assertThrow( com.setIntegration(IntegrationMode::Count, 5), logic_error );
+  com.reset();
+  assertFalse( com.integratedDataReady() );
+  com.clearIntegration();
+
+  com.start();
+  while (com.getSimTime() < max_time) {
+  }
+  com.stop();
+  assertTrue( com.dataReady() );
+  assertFalse( com.integratedDataReady() );
+}
+
+
+void run_blocking() {
+  RadarInterface com(config, {}, 0.02);
+  assertFalse( com.waitData(0.01) );
+  assertThrow( com.getDataBlocking(), logic_error );
+
+  com.start();
+  double previous_time = -1.0; //s
+  for (int n = 0; n < 100; n++) {
+    auto data = com.getDataBlocking();
+    assertTrue( data.getStartTime() > previous_time );
+    previous_time = data.getStartTime();
+  }
+  assertTrue( com.waitData(1.0) );
+  com.stop();
+  assertIntEqual( com.getNumOverruns(), 0 );
+}
+
+
+//with the registries returned, the simulation stops allocating them
+void run_pooled() {
+  RadarInterface com(config, {}, 0.02);
+  com.start();
+  int num_pulses = 0;
+  while (com.getSimTime() < 0.5) {
+    if (com.waitData(0.05)) {
+      auto pulse = com.getPooledData();
+      assertIntEqual( pulse->registry.size(), com.getNumRangeBins() );
+      num_pulses++;
+    }
+  }
+  com.stop();
+
+  cout << "Pooled pulses: " << num_pulses << ", registry allocations: " << com.getRegistryPool().getNumMisses() << endl;
+  assertTrue( num_pulses > 100 );
+  assertTrue( com.getRegistryPool().getNumMisses() < size_t(num_pulses / 10) );
+
+  size_t num_misses = com.getRegistryPool().getNumMisses();
+  while (com.dataReady())
+    com.recycle( com.getData() );
+  com.start();
+  while (com.getSimTime() < 0.6) {
+    if (com.waitData(0.05))
+      com.getPooledData();
+  }
+  com.stop();
+  assertTrue( com.getRegistryPool().getNumMisses() - num_misses <= num_misses ); //the buffers of the first run are reused
+}
+
+
+void run_batch() {
+  RadarInterface com(config, {}, 0.02);
+  com.start();
+  while (com.getSimTime() < 0.1) {
+  }
+  com.stop();
+
+  vector<PulseData> batch(16, PulseData(-1.0, {1, 0, 0}, {}));
+  assertTrue( com.dataReady() );
+  size_t num = com.getDataBatch(batch);
+  assertIntEqual( num, 16 );
+  for (size_t n = 1; n < num; n++)
+    assertDoubleEqual( batch[n].getStartTime() - batch[n-1].getStartTime(), config.getPRT(), 1e-6 );
+
+  double previous_time = batch.back().getStartTime(); //s
+  size_t num_drained = com.drain([&](PulseData&& data) {
+    assertDoubleEqual( data.getStartTime() - previous_time, config.getPRT(), 1e-6 );
+    previous_time = data.getStartTime();
+  });
+  assertTrue( num_drained > 0 );
+  assertFalse( com.dataReady() );
+  assertIntEqual( com.getDataBatch(batch), 0 );
+}
+
+
+//with a blocking consumer and little work, the process sleeps most of the time
+void run_pacing() {
+  RadarInterface com(config, {}, 0.15);
+  assertThrow( com.setPacingSlack(-1e-3), invalid_argument );
+  com.setPacingSlack(1e-3);
+
+  double max_time = 1.0; //s
+  Timer timer;
+  clock_t cpu_start = clock();
+  com.start();
+  while (com.getSimTime() < max_time)
+    if (com.waitData(0.05)) com.getData();
+  double cpu_time = double(clock() - cpu_start) / CLOCKS_PER_SEC; //s
+  assertThrow( com.setPacingSlack(0), logic_error );
+  com.stop();
+
+  cout << "Pacing CPU fraction: " << cpu_time / timer.elapsed() << endl;
+  assertDoubleEqual( timer.elapsed(), max_time, 2e-1 );
+  assertTrue( cpu_time < 0.8 * timer.elapsed() ); //a spinning thread alone would use all of it
+}
+
+
 void run_wrong2() {
   RadarInterface com(config, {});
   com.start();
@@ -213,7 +350,12 @@ int main(int argc , char ** argv) {
   assertThrow(run_wrong3(), logic_error);
 
   run_paused_continued();
+  run_blocking();
+  run_pacing();
+  run_batch();
+  run_pooled();
   run_reset();
+  run_integration();
   run_simulator();
 
 
@@ -3,6 +3,8 @@
 #include <vector>
 #include <memory>
 
+#include <radsim/utils/assert.hpp>
+
 #include <radsim/mathematics/constants.hpp>
 
 #include <radsim/radar/radar_config.hpp>
@@ -21,6 +23,27 @@ void run_simulator(const string& filename) {
   com.start();
   com.stop();
 
+  //the short range radar has a 10-bit ADC
+  assertThrow( ByteRadarInterface(config, {}, dt), invalid_argument );
+  config.setADCResolution(8);
+  ByteRadarInterface byte_com(config, {}, dt);
+  byte_com.start();
+  while (byte_com.getSimTime() < dt) {
+  }
+  byte_com.stop();
+  assertTrue( byte_com.dataReady() );
+  BytePulseData data = byte_com.getData();
+  assertTrue( data.registry.size() > 0 );
+
+  IQRadarInterface iq_com(config, {}, dt);
+  assertThrow( iq_com.setIntegration(IntegrationMode::Count, 4), logic_error );
+  iq_com.start();
+  while (iq_com.getSimTime() < dt) {
+  }
+  iq_com.stop();
+  assertTrue( iq_com.dataReady() );
+  IQPulseData iq_data = iq_com.getData();
+  assertIntEqual( iq_data.registry.size(), 2 * data.registry.size() );
 }
 
 
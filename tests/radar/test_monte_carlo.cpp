@@ -0,0 +1,177 @@
+#include <math.h>
+
+#include <vector>
+#include <set>
+
+#include <radsim/utils/assert.hpp>
+#include <radsim/utils/rng.hpp>
+
+#include <radsim/mathematics/math_vector.hpp>
+
+#include <radsim/radar/radar_config.hpp>
+#include <radsim/radar/radar_config_parser.hpp>
+#include <radsim/radar/radar.hpp>
+#include <radsim/radar/monte_carlo.hpp>
+
+using namespace std;
+using namespace radsim;
+
+
+const unsigned short threshold = 128; //unit, 2.5 avg noise with the test config ADC
+
+
+//number of range bins above threshold, of all range bins
+DetectionCount countCrossings(const PulseData& pulse_data, size_t trial) {
+  unsigned long crossings = 0;
+  for (unsigned short level : pulse_data.registry)
+    if (level >= threshold)
+      crossings++;
+  return DetectionCount(crossings, pulse_data.registry.size());
+}
+
+//unit, a chaos function without chaos
+double halfQ(unsigned int * seed) {
+  return 0.5;
+}
+
+
+void test_confidence_interval() {
+  MonteCarloResult result(10, 5, 10);
+  assertDoubleEqual( result.getProbability(), 0.5, 1e-12 );
+  auto [low, high] = result.getConfidenceInterval(0.95);
+  assertDoubleEqual( low, 0.2366, 1e-3 );
+  assertDoubleEqual( high, 0.7634, 1e-3 );
+
+  auto [low_0, high_0] = MonteCarloResult(100, 0, 100).getConfidenceInterval(0.95);
+  assertDoubleEqual( low_0, 0, 1e-12 );
+  assertTrue( high_0 > 0.03 && high_0 < 0.04 );
+
+  auto [low_none, high_none] = MonteCarloResult(0, 0, 0).getConfidenceInterval();
+  assertDoubleEqual( low_none, 0, 1e-12 );
+  assertDoubleEqual( high_none, 1, 1e-12 );
+}
+
+
+//noise power is exponentially distributed, the false alarm rate of a fixed threshold is exp(-T / avg_noise)
+void test_false_alarm(const RadarConfig& config) {
+  MonteCarloRunner runner(config, 1, 1);
+  MonteCarloResult result = runner.run(200, [](size_t trial) { return TargetCollection(); }, countCrossings);
+
+  Radar radar(config);
+  double pfa = exp( - threshold * radar.getADC().getSensitivity() / radar.getAvgNoise() ); //unit
+  auto [low, high] = result.getConfidenceInterval(0.999);
+  assertIntEqual( result.getNumTrials(), 200 );
+  assertIntEqual( result.getNumOpportunities(), 200 * radar.getNumRangeBins() );
+  assertTrue( low < pfa && pfa < high );
+  assertTrue( high - low < 0.01 );
+}
+
+
+//a target well above the noise is detected in every trial, in its own range bin
+void test_detection(const RadarConfig& config) {
+  MonteCarloRunner runner(config, 2, 1);
+  TargetCollection targets;
+  targets.emplace_back( math_vector{3000, 0, 0}, 10 );
+  Radar radar(config);
+  int bin = (3000 - radar.getMinimumRange()) / radar.getRangeBin() + 1; //first bin of the full echo
+
+  MonteCarloResult result = runner.run(100,
+                                       [&](size_t trial) { return targets; },
+                                       [&](const PulseData& pulse_data, size_t trial) { return pulse_data.registry[bin] >= threshold; });
+  assertIntEqual( result.getNumDetections(), 100 );
+  assertDoubleEqual( result.getProbability(), 1, 1e-12 );
+}
+
+
+//the result depends on the seed only, not on threads or shards
+void test_deterministic(const RadarConfig& config) {
+  auto empty = [](size_t trial) { return TargetCollection(); };
+
+  MonteCarloRunner serial(config, 7, 0);
+  assertIntEqual( serial.getNumThreads(), 1 );
+  MonteCarloResult serial_result = serial.run(50, empty, countCrossings);
+
+  MonteCarloRunner parallel(config, 7, 2);
+  parallel.setShardSize(3);
+  assertIntEqual( parallel.getShardSize(), 3 );
+  MonteCarloResult parallel_result = parallel.run(50, empty, countCrossings);
+  assertIntEqual( parallel_result.getNumDetections(), serial_result.getNumDetections() );
+  assertIntEqual( parallel_result.getNumOpportunities(), serial_result.getNumOpportunities() );
+
+  //a run split into shares sums to the whole run
+  MonteCarloResult first = parallel.run(0, 20, empty, countCrossings);
+  MonteCarloResult second = serial.run(20, 50, empty, countCrossings);
+  assertIntEqual( first.getNumTrials() + second.getNumTrials(), 50 );
+  assertIntEqual( first.getNumDetections() + second.getNumDetections(), serial_result.getNumDetections() );
+
+  //a trial is the same pulse whatever runs before it
+  vector<unsigned long> counts(50, 0);
+  serial.run(50, empty, [&](const PulseData& pulse_data, size_t trial) {
+    counts[trial] = countCrossings(pulse_data, trial).detections;
+    return false;
+  });
+  assertIntEqual( parallel.run(50, empty, [&](const PulseData& pulse_data, size_t trial) {
+    return countCrossings(pulse_data, trial).detections == counts[trial];
+  }).getNumDetections(), 50 );
+
+  parallel.setSeed(8);
+  assertIntEqual( parallel.getSeed(), 8 );
+  assertFalse( parallel.run(50, empty, countCrossings).getNumDetections() == serial_result.getNumDetections() );
+
+  assertFalse( MonteCarloRunner::getTrialSeed(7, 0) == MonteCarloRunner::getTrialSeed(7, 1) );
+  assertFalse( MonteCarloRunner::getTrialSeed(7, 0) == MonteCarloRunner::getTrialSeed(8, 0) );
+}
+
+
+//the first numbers drawn by different trials are all different, no stream runs into another
+void test_trial_streams() {
+  const size_t num_trials = 64;
+  const size_t num_draws = 4096;
+  set<double> drawn; //unit
+  for (size_t trial = 0; trial < num_trials; trial++) {
+    RNG rng(MonteCarloRunner::getTrialSeed(7, trial), &RNG::splitmix64);
+    for (size_t n = 0; n < num_draws; n++)
+      drawn.insert( rng.output() );
+  }
+  assertIntEqual( drawn.size(), num_trials * num_draws );
+}
+
+
+//radar settings are applied to every thread
+void test_setup(const RadarConfig& config) {
+  MonteCarloRunner runner(config, 0, 2);
+  runner.setupRadars([](Radar& radar) { radar.setToAddNoise(false); });
+  MonteCarloResult result = runner.run(20, [](size_t trial) { return TargetCollection(); }, countCrossings);
+  assertIntEqual( result.getNumDetections(), 0 );
+
+  //a custom chaos function is kept, and gives every trial the same noise
+  MonteCarloRunner serial(config, 0, 0);
+  serial.setupRadars([](Radar& radar) { radar.setRandomParameters(true, 0, &halfQ); });
+  vector<unsigned short> first;
+  result = serial.run(20, [](size_t trial) { return TargetCollection(); }, [&](const PulseData& pulse_data, size_t trial) {
+    if (trial == 0)
+      first = pulse_data.registry;
+    return pulse_data.registry == first;
+  });
+  assertIntEqual( result.getNumDetections(), 20 );
+}
+
+
+int main(int argc, char** argv) {
+  string config_dir = string(argv[1]) + "/radar_configs";
+  RadarConfig config = RadarConfigParser().parseFile(config_dir + "/short_range_radar.txt");
+
+  test_confidence_interval();
+  test_false_alarm(config);
+  test_detection(config);
+  test_deterministic(config);
+  test_trial_streams();
+  test_setup(config);
+
+  MonteCarloRunner runner(config, 0, 0);
+  assertThrow( runner.setShardSize(0), invalid_argument );
+  assertThrow( runner.run(1, nullptr, countCrossings), invalid_argument );
+  assertThrow( runner.run(2, 1, [](size_t trial) { return TargetCollection(); }, countCrossings), invalid_argument );
+  assertThrow( MonteCarloResult(1, 1, 1).getConfidenceInterval(1), invalid_argument );
+  return 0;
+}
@@ -0,0 +1,110 @@
+#include <math.h>
+
+#include <vector>
+#include <string>
+#include <sstream>
+
+#include <radsim/utils/assert.hpp>
+
+#include <radsim/radar/radar_config.hpp>
+#include <radsim/radar/radar_config_parser.hpp>
+#include <radsim/radar/radar.hpp>
+#include <radsim/radar/parameter_sweep.hpp>
+
+using namespace std;
+using namespace radsim;
+
+
+//every point gets the radar of its own config, in the same order as getPointValues
+void test_grid(const RadarConfig& config) {
+  ParameterSweep sweep(config, 2);
+  assertIntEqual( sweep.getNumThreads(), 3 );
+  sweep.addAxis("PulseWidth", {0.25, 0.5});
+  sweep.addAxis("NoiseFigure", {2, 4, 6});
+  sweep.addAxis("ADCResolution", {8, 10});
+  assertIntEqual( sweep.getNumAxes(), 3 );
+  assertIntEqual( sweep.getNumPoints(), 12 );
+
+  vector<double> values = sweep.getPointValues(7); //(1, 0, 1)
+  assertDoubleEqual( values[0], 0.5, 1e-12 );
+  assertDoubleEqual( values[1], 2, 1e-12 );
+  assertDoubleEqual( values[2], 10, 1e-12 );
+  assertDoubleEqual( sweep.getConfig(7).getPulseWidth(), 0.5e-6, 1e-9 );
+
+  SweepTable table = sweep.run([](Radar& radar, size_t point) {
+    return vector<double>{ radar.getPulseWidth(), radar.getAvgNoise(), (double) radar.getADC().getNumLevels() };
+  }, {"pw", "AvgNoise", "Levels"});
+
+  assertIntEqual( table.getNumRows(), 12 );
+  assertIntEqual( table.getNumColumns(), 6 );
+  assertTrue( table.getColumnNames()[0] == "PulseWidth" );
+  assertTrue( table.getColumnNames()[4] == "AvgNoise" );
+
+  for (size_t point = 0; point < 12; point++) {
+    Radar radar( sweep.getConfig(point) );
+    assertDoubleEqual( table.getColumn("PulseWidth")[point], table.getColumn("pw")[point] * 1e6, 1e-9 );
+    assertDoubleEqual( table.getColumn("AvgNoise")[point], radar.getAvgNoise(), 1e-12 );
+    assertDoubleEqual( table.getColumn(5)[point], pow(2, table.getColumn("ADCResolution")[point]), 1e-12 );
+  }
+
+  //noise grows with the noise figure
+  const vector<double>& noise = table.getColumn("AvgNoise");
+  assertTrue( noise[0] < noise[2] && noise[2] < noise[4] );
+}
+
+
+void test_no_axes(const RadarConfig& config) {
+  ParameterSweep sweep(config, 0);
+  assertIntEqual( sweep.getNumPoints(), 1 );
+  SweepTable table = sweep.run([](Radar& radar, size_t point) { return vector<double>{ 1.0 }; }, {"one"});
+  assertIntEqual( table.getNumRows(), 1 );
+
+  ostringstream out;
+  table.writeCSV(out);
+  assertTrue( out.str() == "one\n1\n" );
+}
+
+
+void test_csv(const RadarConfig& config) {
+  ParameterSweep sweep(config, 0);
+  sweep.addAxis("NoiseFigure", {2, 4});
+  SweepTable table = sweep.run([](Radar& radar, size_t point) { return vector<double>{ (double) point }; }, {"point"});
+
+  ostringstream out;
+  table.writeCSV(out);
+  assertTrue( out.str() == "NoiseFigure,point\n2,0\n4,1\n" );
+
+  SweepTable share = sweep.run([](Radar& radar, size_t point) { return vector<double>{ (double) point }; }, {"point"}, 1, 2);
+  assertIntEqual( share.getNumRows(), 1 );
+  assertDoubleEqual( share.getColumn("NoiseFigure")[0], 4, 1e-12 );
+  assertDoubleEqual( share.getColumn("point")[0], 1, 1e-12 );
+  assertThrow( sweep.run([](Radar& radar, size_t point) { return vector<double>{ 0.0 }; }, {"point"}, 1, 3), invalid_argument );
+}
+
+
+void wrong_metric_size(const RadarConfig& config) {
+  ParameterSweep sweep(config, 1);
+  sweep.addAxis("NoiseFigure", {2, 4});
+  sweep.run([](Radar& radar, size_t point) { return vector<double>{ 1.0 }; }, {"a", "b"});
+}
+
+
+int main(int argc, char** argv) {
+  string config_dir = string(argv[1]) + "/radar_configs";
+  RadarConfig config = RadarConfigParser().parseFile(config_dir + "/short_range_radar.txt");
+
+  test_grid(config);
+  test_no_axes(config);
+  test_csv(config);
+
+  ParameterSweep sweep(config, 0);
+  assertThrow( sweep.addAxis("PulseWidth", {}), invalid_argument );
+  assertThrow( sweep.addAxis("ADCMode", {1}), invalid_argument );
+  assertThrow( sweep.addAxis("ADCResolution", {8.5}), invalid_argument );
+  sweep.addAxis("PulseWidth", {0.25});
+  assertThrow( sweep.addAxis("PulseWidth", {0.5}), invalid_argument );
+  assertThrow( sweep.getPointValues(1), invalid_argument );
+  assertThrow( wrong_metric_size(config), invalid_argument );
+  assertThrow( SweepTable({"a"}, {}), invalid_argument );
+  return 0;
+}
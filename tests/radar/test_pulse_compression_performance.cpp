@@ -0,0 +1,49 @@
+#include <vector>
+#include <complex>
+
+#include <radsim/utils/timer.hpp>
+#include <radsim/utils/assert.hpp>
+
+#include <radsim/radar/radar_config.hpp>
+#include <radsim/radar/radar_config_parser.hpp>
+#include <radsim/radar/radar.hpp>
+#include <radsim/radar/pulse_compressor.hpp>
+
+using namespace std;
+using namespace radsim;
+
+
+//Compression of every pulse of the naval radar with a 20 microsec chirp, at all range bins.
+//The time per pulse must be well within the pulse repetition time, also in debug builds.
+void run_compression(RadarConfig config) {
+  config.setPulseWidth(20.0);
+  config.setSamplingTime(0.25);
+  config.setWaveform(Waveform::LFM);
+  config.setChirpBandWidth(4.0);
+  Radar radar(config);
+  PulseCompressor compressor(radar);
+
+  int num_pulses = 200;
+  vector<IQPulseData> pulses;
+  for (int n = 0; n < 10; n++)
+    pulses.push_back( radar.generateIQPulseData() );
+
+  vector<complex<double>> compressed;
+  Timer timer;
+  for (int n = 0; n < num_pulses; n++)
+    compressor.compress(pulses[n % pulses.size()], compressed);
+  double time_per_pulse = timer.elapsed() / num_pulses; //s
+
+  cout << "Range bins: " << radar.getNumRangeBins() << ", replica length: " << compressor.getReplicaLength() 
+       << ", FFT size: " << compressor.getFFTSize() << endl;
+  cout << "Time per pulse (ms): " << 1e3 * time_per_pulse << ", PRT (ms): " << 1e3 * radar.getPRT() << endl;
+  assertTrue( time_per_pulse < 0.5 * radar.getPRT() );
+}
+
+
+int main(int argc , char ** argv) {
+
+  const string config_file = string(argv[1]) + "/radar_configs/naval_radar.txt";
+  run_compression( RadarConfigParser().parseFile(config_file) );
+  return 0;
+}
@@ -0,0 +1,122 @@
+#include <math.h>
+
+#include <vector>
+#include <complex>
+
+#include <radsim/utils/assert.hpp>
+
+#include <radsim/mathematics/constants.hpp>
+#include <radsim/mathematics/mathutils.hpp>
+
+#include <radsim/radar/radar_config.hpp>
+#include <radsim/radar/radar_config_parser.hpp>
+#include <radsim/radar/radar.hpp>
+#include <radsim/radar/pulse_compressor.hpp>
+
+using namespace std;
+using namespace radsim;
+
+
+//A 5 microsec chirp sweeping 4 Mhz, sampled at 4 Mhz: 20 samples per pulse.
+RadarConfig lfmConfig(RadarConfig config) {
+  config.setPulseWidth(5.0);
+  config.setSamplingTime(0.25);
+  config.setWaveform(Waveform::LFM);
+  config.setChirpBandWidth(4.0);
+  return config;
+}
+
+
+//the echo of a long chirp is spread over 20 bins, and compressed to the first of them.
+void test_lfm_compression(const RadarConfig& config) {
+  Radar radar( lfmConfig(config) );
+  radar.setToAddClutter(false);
+  radar.setToAddNoise(false);
+  assertTrue( radar.getWaveform() == Waveform::LFM );
+  assertDoubleEqual( radar.getChirpBandWidth(), 4e6, 1e-6 );
+
+  PulseCompressor compressor(radar);
+  assertIntEqual( compressor.getReplicaLength(), 20 );
+  assertTrue( compressor.getFFTSize() >= 80 );
+
+  double signal_override = 4 * radar.getAvgNoise(); //W, below ADC saturation
+  double amplitude = radar.getADC().convertAmplitude( powerToAmp(signal_override) ); //unit
+  int bin_index = 253;
+  TargetCollection targets;
+  targets.emplace_back( (math_vector){radar.getRange(bin_index), 0, 0}, 1.0 );
+
+  IQPulseData pulse_data = radar.generateIQPulseData(targets, true, signal_override);
+  //uncompressed echo: filtered pulse envelope, chirped phase
+  double I = pulse_data.registry[2 * (bin_index + 10)];
+  double Q = pulse_data.registry[2 * (bin_index + 10) + 1];
+  double envelope = radar.getFilteredPulse().output( 10 * radar.getSamplingTime() ); //unit
+  assertDoubleEqual( sqrt(I * I + Q * Q), envelope * amplitude, 2e-2 );
+
+  vector<complex<double>> compressed = compressor.compress(pulse_data);
+  assertIntEqual( compressed.size(), radar.getNumRangeBins() );
+  int peak = 0;
+  for (int n = 0; n < (int) compressed.size(); n++)
+    if (abs(compressed[n]) > abs(compressed[peak]))
+      peak = n;
+  assertIntEqual( peak, bin_index );
+  assertTrue( abs(compressed[peak]) > 0.8 * amplitude );
+  assertTrue( abs(compressed[peak + 3]) < 0.25 * abs(compressed[peak]) );
+  assertTrue( abs(compressed[peak + 10]) < 0.25 * abs(compressed[peak]) );
+  assertTrue( abs(compressed[100]) < 1e-9 );
+}
+
+
+//the overlap-save blocks give the same result as a direct correlation
+void test_direct_correlation(const RadarConfig& config) {
+  Radar radar( lfmConfig(config) );
+  PulseCompressor compressor(radar);
+  IQPulseData pulse_data = radar.generateIQPulseData();
+  vector<complex<double>> compressed = compressor.compress(pulse_data);
+
+  auto replica = radar.getPulseReplica();
+  int L = replica.size();
+  int num_bins = radar.getNumRangeBins();
+  for (int n = 0; n < num_bins; n += 7) {
+    complex<double> sum = 0;
+    for (int m = 0; m < L && n + m < num_bins; m++)
+      sum += complex<double>( pulse_data.registry[2 * (n + m)], pulse_data.registry[2 * (n + m) + 1] ) * conj(replica[m]);
+    assertComplexEqual( compressed[n], sum / (double) L, 1e-8 );
+  }
+}
+
+
+//the rectangular pulse replica is a constant
+void test_rectangular(const RadarConfig& config) {
+  Radar radar(config);
+  assertTrue( radar.getWaveform() == Waveform::Rectangular );
+  auto replica = radar.getPulseReplica();
+  assertIntEqual( replica.size(), 1 );
+  assertComplexEqual( replica[0], 1.0, 1e-12 );
+}
+
+
+void wrong_size(const RadarConfig& config) {
+  Radar radar( lfmConfig(config) );
+  PulseCompressor compressor(radar);
+  compressor.compress( IQPulseData(0, {1, 0, 0}, {1, 2, 3, 4}) );
+}
+
+
+void no_chirp_bandwidth(RadarConfig config) {
+  config.setWaveform(Waveform::LFM);
+  config.assertParametersSet();
+}
+
+
+int main(int argc , char ** argv) {
+
+  const string config_file = string(argv[1]) + "/radar_configs/short_range_radar.txt";
+  RadarConfig config = RadarConfigParser().parseFile(config_file);
+  test_lfm_compression(config);
+  test_direct_correlation(config);
+  test_rectangular(config);
+
+  assertThrow( wrong_size(config), invalid_argument );
+  assertThrow( no_chirp_bandwidth(config), logic_error );
+  return 0;
+}
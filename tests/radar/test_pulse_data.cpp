@@ -57,11 +57,26 @@ void test_move() {
   assertTrue( other.hasOriginalRegistry() );  
 }
 
+void test_byte() {
+  vector<unsigned char> reg = {1, 2, 255};
+  unsigned char * ptr = reg.data();
+
+  BytePulseData data(0.5, (math_vector){1, 0, 0}, move(reg));
+  assertTrue( data.isOriginal() );
+  assertTrue( data.hasOriginalRegistry() );
+  assertTrue( data.registry.data() == ptr );
+  assertIntEqual( data.registry[2], 255 );
+
+  BytePulseData other = move(data);
+  assertTrue( other.hasOriginalRegistry() );
+}
+
 int main() {
 
   test_simple();
   test_return();
   test_copy();
   test_move();
+  test_byte();
   return 0;
 }
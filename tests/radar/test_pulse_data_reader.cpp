@@ -66,8 +66,9 @@ void testWrongFileStructure() {
   
   ofstream ofs(filename);
 
+  int version = 0;
   int num = 123456;
-  ofs.write((char *) &num, sizeof num); //written file version
+  ofs.write((char *) &version, sizeof version); //written file version
   ofs.write((char *) &num, sizeof num); //started writing in pulse data segment
   ofs.close();
 
@@ -99,8 +100,82 @@ void testClose() {
   assertThrow(reader.read(), logic_error);
 }
 
+void testByteReader() {
+  const string filename = "filename4";
+
+  math_vector v = {1.5, 1.25, 1.75};
+  BytePulseDataWriter writer(filename);
+  writer.write( BytePulseData(4.5, v, {3, 30, 250}) );
+  writer.close();
+
+  BytePulseDataReader reader(filename);
+  BytePulseData pulse = reader.read();
+  assertTrue(reader.eof());
+  assertDoubleEqual(pulse.getStartTime(), 4.5, 1e-5);
+  assertIntEqual(pulse.registry.size(), 3);
+  assertIntEqual(pulse.registry[0], 3);
+  assertIntEqual(pulse.registry[1], 30);
+  assertIntEqual(pulse.registry[2], 250);
+  reader.close();
+
+  //a file of 1 byte samples cannot be read as 2 byte samples, and vice versa
+  assertThrow( {PulseDataReader wrong_reader(filename);}, invalid_argument );
+  createDataFile(filename);
+  assertThrow( {BytePulseDataReader wrong_reader(filename);}, invalid_argument );
+}
+
+void testIQReader() {
+  const string filename = "filename6";
+
+  math_vector v = {1.5, 1.25, 1.75};
+  IQPulseDataWriter writer(filename);
+  writer.write( IQPulseData(2.5, v, {-3, 300, 12, -700}) );
+  writer.close();
+
+  IQPulseDataReader reader(filename);
+  IQPulseData pulse = reader.read();
+  assertTrue(reader.eof());
+  assertIntEqual(pulse.registry.size(), 4);
+  assertIntEqual(pulse.registry[0], -3);
+  assertIntEqual(pulse.registry[3], -700);
+  reader.close();
+
+  //I/Q and magnitude files have the same sample size, but cannot be read as each other
+  assertThrow( {PulseDataReader wrong_reader(filename);}, invalid_argument );
+  createDataFile(filename);
+  assertThrow( {IQPulseDataReader wrong_reader(filename);}, invalid_argument );
+}
+
+void testVersionZero() {
+  const string filename = "filename5";
+
+  ofstream ofs(filename);
+  int version = 0;
+  double t = 1.5;
+  double x = 1.0;
+  int size = 2;
+  unsigned short data[2] = {7, 900};
+  ofs.write((char *) &version, sizeof version);
+  ofs.write((char *) &t, sizeof t);
+  ofs.write((char *) &x, sizeof x);
+  ofs.write((char *) &x, sizeof x);
+  ofs.write((char *) &x, sizeof x);
+  ofs.write((char *) &size, sizeof size);
+  ofs.write((char *) data, sizeof data);
+  ofs.close();
+
+  PulseDataReader reader(filename);
+  PulseData pulse = reader.read();
+  assertDoubleEqual(pulse.getStartTime(), 1.5, 1e-5);
+  assertIntEqual(pulse.registry[1], 900);
+  assertTrue(reader.eof());
+}
+
 int main() {
   test_reader();
+  testByteReader();
+  testIQReader();
+  testVersionZero();
   testWrongFileStructure();
   testMissingFileVersion();
   testClose();
@@ -54,7 +54,9 @@ void test_write_pulses() {
   if (!in)
     throw invalid_argument("File does not exist.");
 
-  //test file version
+  //test file version, sample size and sample kind
+  assertIntEqual(getInt(in), 2);
+  assertIntEqual(getInt(in), 2);
   assertIntEqual(getInt(in), 0);
 
   //assertTime
@@ -87,6 +89,46 @@ void test_write_pulses() {
 }
 
 
+void test_write_byte_pulses() {
+  const string filename = "filename2";
+
+  math_vector v = {0.5, 0.25, 0.75};
+  vector<unsigned char> data = {5, 100, 255};
+
+  BytePulseData pulse(2.5, v, data);
+
+  BytePulseDataWriter writer(filename);
+  writer.write(pulse);
+  writer.close();
+
+  ifstream in(filename);
+  if (!in)
+    throw invalid_argument("File does not exist.");
+
+  //test file version, sample size and sample kind
+  assertIntEqual(getInt(in), 2);
+  assertIntEqual(getInt(in), 1);
+  assertIntEqual(getInt(in), 0);
+
+  assertDoubleEqual(getDouble(in), 2.5, 1e-3);
+  assertDoubleEqual(getDouble(in), v[0], 1e-3);
+  assertDoubleEqual(getDouble(in), v[1], 1e-3);
+  assertDoubleEqual(getDouble(in), v[2], 1e-3);
+  assertIntEqual(getInt(in), 3);
+
+  //one byte per sample
+  unsigned char samples[3];
+  in.read(reinterpret_cast<char *>(samples), sizeof(samples));
+  assertIntEqual(samples[0], 5);
+  assertIntEqual(samples[1], 100);
+  assertIntEqual(samples[2], 255);
+
+  in.peek();
+  assertTrue(in.eof());
+  in.close();
+}
+
+
 void test_cannot_write_after_closed() {
   PulseDataWriter writer("filename1");
   writer.close();
@@ -101,6 +143,7 @@ void test_cannot_write_after_closed() {
 
 int main() {
   test_write_pulses();
+  test_write_byte_pulses();
   test_cannot_write_after_closed();
   return 0;
 }
@@ -0,0 +1,109 @@
+#include <vector>
+#include <memory>
+
+#include <radsim/utils/assert.hpp>
+
+#include <radsim/mathematics/constants.hpp>
+#include <radsim/mathematics/math_vector.hpp>
+
+#include <radsim/radar/pulse_data.hpp>
+#include <radsim/radar/pulse_integrator.hpp>
+
+using namespace std;
+using namespace radsim;
+
+
+void test_count() {
+  PulseIntegrator<unsigned short> integrator(IntegrationMode::Count, 3);
+  math_vector boresight = {1, 0, 0};
+
+  assertFalse( integrator.add( PulseData(0.1, boresight, {65535, 1, 2}) ) );
+  assertFalse( integrator.add( PulseData(0.2, boresight, {65535, 1, 2}) ) );
+  assertFalse( integrator.ready() );
+  assertTrue( integrator.add( PulseData(0.3, boresight, {65535, 1, 2}) ) );
+
+  IntegratedPulseData data = integrator.getIntegrated();
+  assertFalse( integrator.ready() );
+  assertIntEqual( data.getNumPulses(), 3 );
+  assertDoubleEqual( data.getStartTime(), 0.1, 1e-6 );
+  assertDoubleEqual( data.getEndTime(), 0.3, 1e-6 );
+  assertTrue( math_vector_equal(data.getBoresight(), boresight, 1e-6) );
+  assertIntEqual( data.registry.size(), 3 );
+  assertTrue( data.registry[0] == 3 * 65535u ); //no overflow in wide accumulator
+  assertIntEqual( data.registry[1], 3 );
+  assertIntEqual( data.registry[2], 6 );
+
+  //next record starts from zero
+  integrator.add( PulseData(0.4, boresight, {1, 1, 1}) );
+  integrator.flush();
+  assertTrue( integrator.ready() );
+  data = integrator.getIntegrated();
+  assertIntEqual( data.getNumPulses(), 1 );
+  assertIntEqual( data.registry[0], 1 );
+}
+
+
+void test_azimuth_cell() {
+  double cell_width = 10 * pi / 180.0; //rad
+  PulseIntegrator<unsigned char> integrator(IntegrationMode::AzimuthCell, cell_width);
+
+  //pulses at 1, 4, 7 deg in cell 0, 11 deg in cell 1
+  vector<double> angles = {1, 4, 7, 11};
+  int num_ready = 0;
+  for (double angle : angles) {
+    double theta = angle * pi / 180.0; //rad
+    math_vector boresight = {cos(theta), sin(theta), 0};
+    if (integrator.add( BytePulseData(angle, boresight, {200, 1}) ))
+      num_ready++;
+  }
+  assertIntEqual( num_ready, 1 );
+
+  IntegratedPulseData data = integrator.getIntegrated();
+  assertIntEqual( data.getNumPulses(), 3 );
+  assertIntEqual( data.registry[0], 600 );
+  assertDoubleEqual( data.getStartTime(), 1, 1e-6 );
+  assertDoubleEqual( data.getEndTime(), 7, 1e-6 );
+  math_vector mean_boresight = {cos(4 * pi / 180.0), sin(4 * pi / 180.0), 0};
+  assertTrue( math_vector_equal(data.getBoresight(), mean_boresight, 1e-3) );
+
+  integrator.reset();
+  integrator.flush();
+  assertFalse( integrator.ready() );
+}
+
+
+//a recycled registry is reused for the next record
+void test_recycle() {
+  PulseIntegrator<unsigned short> integrator(IntegrationMode::Count, 1);
+  integrator.add( PulseData(0.1, {1, 0, 0}, {1, 2, 3}) );
+  IntegratedPulseData data = integrator.getIntegrated();
+  const unsigned int * buffer = data.registry.data();
+  integrator.recycle( move(data) );
+
+  integrator.add( PulseData(0.2, {1, 0, 0}, {4, 5, 6}) );
+  data = integrator.getIntegrated();
+  assertTrue( data.registry.data() == buffer );
+  assertIntEqual( data.registry[0], 4 );
+  assertIntEqual( data.registry[2], 6 );
+}
+
+
+void wrong_size() {
+  PulseIntegrator<unsigned short> integrator(IntegrationMode::Count, 3);
+  integrator.add( PulseData(0.1, {1, 0, 0}, {1, 2, 3}) );
+  integrator.add( PulseData(0.2, {1, 0, 0}, {1, 2}) );
+}
+
+
+int main() {
+  test_count();
+  test_azimuth_cell();
+  test_recycle();
+
+  assertThrow( wrong_size(), invalid_argument );
+  assertThrow( PulseIntegrator<unsigned short>(IntegrationMode::Count, 0), invalid_argument );
+  assertThrow( PulseIntegrator<unsigned short>(IntegrationMode::Count, 2.7), invalid_argument );
+  assertThrow( PulseIntegrator<unsigned short>(IntegrationMode::AzimuthCell, -1.0), invalid_argument );
+  assertThrow( PulseIntegrator<unsigned short>(IntegrationMode::Count, 1).getIntegrated(), logic_error );
+  return 0;
+}
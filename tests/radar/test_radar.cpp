@@ -176,6 +176,25 @@ void test_naval_radar(const RadarConfig& config) {
 
 
 
+//8-bit ADC data can be stored in byte registries, with the same samples as a 16-bit registry.
+void test_byte_registry(RadarConfig config) {
+  Radar radar(config);
+  assertThrow( radar.generatePulseData<unsigned char>(), logic_error );
+
+  config.setADCResolution(8);
+  Radar radar_8(config);
+  radar_8.setRandomParameters(true, 0, &RandReplacement);
+  PulseData pulse = radar_8.generatePulseData();
+  radar_8.reset();
+  BytePulseData byte_pulse = radar_8.generatePulseData<unsigned char>();
+  assertTrue( byte_pulse.hasOriginalRegistry() );
+  assertIntEqual( byte_pulse.registry.size(), pulse.registry.size() );
+  for (size_t n = 0; n < pulse.registry.size(); n++)
+    assertIntEqual( byte_pulse.registry[n], pulse.registry[n] );
+  assertDoubleEqual( byte_pulse.getStartTime(), pulse.getStartTime(), 1e-5 );
+}
+
+
 int main(int argc , char ** argv) {
 
   const string config_file = string(argv[1]) + "/radar_configs/short_range_radar.txt";
@@ -183,6 +202,7 @@ int main(int argc , char ** argv) {
   RadarConfig config = parser.parseFile(config_file);
   test_radar(config_file);
   test_radar_equation(config);
+  test_byte_registry(config);
 
   const string config_file_nav = string(argv[1]) + "/radar_configs/naval_radar.txt";
   auto config_nav = parser.parseFile(config_file_nav);
@@ -35,11 +35,11 @@ void test_queue() {
 
   assertTrue( queue.isEmpty() );
   assertIntEqual( queue.size(), 0 );
-  queue.pushInitial( PulseData(1.0, boresight, move(s1)) );  // ----- queue = {p1}
+  queue.push( PulseData(1.0, boresight, move(s1)) );  // ----- queue = {p1}
   assertFalse( queue.isEmpty() );
   assertIntEqual( queue.size(), 1 );
   queue.push( PulseData(2.0, boresight, move(s2)) );  // ----- queue = {p1, p2}
-  assertTrue( queue.size() );
+  assertIntEqual( queue.size(), 2 );
   auto pkg_1 = queue.pop(); // ---- queue = {p2}
   assertTrue( pkg_1.registry.data() == ptr1 );
   assertTrue( pkg_1.hasOriginalRegistry() );
@@ -63,6 +63,11 @@ void test_queue() {
   assertTrue( pkg_4.registry.data() == ptr4 );
   assertTrue( queue.size() == 2);
 
+  //the last pushed element is available as well
+  queue.pop();
+  auto pkg_6 = queue.pop(); // ---- queue = {}
+  assertDoubleEqual( pkg_6.getStartTime(), 6.0, 1e-12 );
+  assertTrue( queue.isEmpty() );
 }
 
 void test_empty() {
@@ -73,9 +78,9 @@ void test_empty() {
   registry s3 = {1, 2, 3};
 
   RadarDataQueue queue;
-  queue.pushInitial( PulseData(1.0, boresight, move(s1)) );
-  queue.push( PulseData(1.0, boresight, move(s2)) );
-  queue.push( PulseData(1.0, boresight, move(s3)) );  
+  queue.push( PulseData(1.0, boresight, registry(s1)) );
+  queue.push( PulseData(1.0, boresight, registry(s2)) );
+  queue.push( PulseData(1.0, boresight, registry(s3)) );  
 
   assertFalse( queue.isEmpty() );
   
@@ -83,62 +88,101 @@ void test_empty() {
 
   assertTrue( queue.isEmpty() );
 
-  queue.pushInitial( PulseData(1.0, boresight, move(s1)) );
-  queue.push( PulseData(1.0, boresight, move(s2)) );
-  queue.push( PulseData(1.0, boresight, move(s3)) );  
+  queue.push( PulseData(1.0, boresight, registry(s1)) );
+  queue.push( PulseData(1.0, boresight, registry(s2)) );
+  queue.push( PulseData(1.0, boresight, registry(s3)) );  
 
   assertFalse( queue.isEmpty() );  
+  assertIntEqual( queue.size(), 3 );
 }
 
 
-void test_empty_queue_exception() {
+//a full queue refuses the push, leaves the data with the caller, and counts an overrun
+void test_full() {
   math_vector boresight = {1, 0, 0};
 
-  registry s1 = {1};
-  registry s2 = {1, 2};
-
-  unsigned short * ptr1 = s1.data();
-  unsigned short * ptr2 = s2.data();
-
-  RadarDataQueue queue;
-
-  queue.pushInitial( PulseData(1.0, boresight, move(s1)) ); 
-  queue.push( PulseData(1.0, boresight, move(s2)) );
-  queue.size();
-  queue.pop();
-  queue.size();
-  queue.pop();
+  RadarDataQueue queue(3);
+  assertIntEqual( queue.getCapacity(), 4 );
+  for (int n = 0; n < 4; n++)
+    assertTrue( queue.push( PulseData(n, boresight, registry(n + 1)) ) );
+
+  PulseData overflow(4.0, boresight, registry(5));
+  const unsigned short * ptr = overflow.registry.data();
+  assertFalse( queue.push( move(overflow) ) );
+  assertTrue( overflow.registry.data() == ptr );
+  assertIntEqual( queue.getNumOverruns(), 1 );
+  assertIntEqual( queue.size(), 4 );
+
+  //wraps around the ring
+  for (int n = 0; n < 10; n++) {
+    auto pkg = queue.pop();
+    assertDoubleEqual( pkg.getStartTime() + 1, n + 1, 1e-12 );
+    assertTrue( queue.push( PulseData(n + 4, boresight, registry(1)) ) );
+  }
+  assertIntEqual( queue.size(), 4 );
+  assertIntEqual( queue.getNumOverruns(), 1 );
+
+  assertThrow( RadarDataQueue(0), invalid_argument );
 }
 
 
-void test_pushed_initial_twice() {
+void test_batch() {
   math_vector boresight = {1, 0, 0};
 
-  registry s1 = {1};
-  registry s2 = {1, 2};
-
-  unsigned short * ptr1 = s1.data();
-  unsigned short * ptr2 = s2.data();
+  RadarDataQueue queue(8);
+  vector<const unsigned short *> ptrs;
+  for (int n = 0; n < 6; n++) {
+    registry reg(n + 1);
+    ptrs.push_back( reg.data() );
+    queue.push( PulseData(n, boresight, move(reg)) );
+  }
+
+  vector<PulseData> batch(4, PulseData(-1.0, boresight, {}));
+  assertIntEqual( queue.popInto(batch), 4 );
+  for (int n = 0; n < 4; n++) {
+    assertDoubleEqual( batch[n].getStartTime() + 1, n + 1, 1e-12 );
+    assertTrue( batch[n].registry.data() == ptrs[n] );
+  }
+  assertIntEqual( queue.size(), 2 );
 
-  RadarDataQueue queue;
+  //only the ready elements are taken
+  assertIntEqual( queue.popInto(batch), 2 );
+  assertDoubleEqual( batch[1].getStartTime(), 5.0, 1e-12 );
+  assertIntEqual( queue.popInto(batch), 0 );
+
+  //wraps around the ring
+  for (int n = 6; n < 12; n++)
+    queue.push( PulseData(n, boresight, registry(1)) );
+  vector<double> times;
+  assertIntEqual( queue.drain([&](PulseData&& data) { times.push_back(data.getStartTime()); }, 4), 4 );
+  assertIntEqual( queue.drain([&](PulseData&& data) { times.push_back(data.getStartTime()); }), 2 );
+  assertIntEqual( times.size(), 6 );
+  for (int n = 0; n < 6; n++)
+    assertDoubleEqual( times[n], n + 6, 1e-12 );
+  assertTrue( queue.isEmpty() );
 
-  queue.pushInitial( PulseData(1.0, boresight, move(s1)) ); 
-  queue.pushInitial( PulseData(1.0, boresight, move(s2)) ); 
+  //a throwing callback leaves the rest in the queue
+  for (int n = 0; n < 3; n++)
+    queue.push( PulseData(n, boresight, registry(1)) );
+  assertThrow( queue.drain([](PulseData&& data) { throw runtime_error("stop"); }), runtime_error );
+  assertIntEqual( queue.size(), 2 );
+  assertDoubleEqual( queue.pop().getStartTime(), 1.0, 1e-12 );
 }
 
 
-void test_not_pushed_initial() {
+void test_empty_queue_exception() {
   math_vector boresight = {1, 0, 0};
 
   registry s1 = {1};
   registry s2 = {1, 2};
 
-  unsigned short * ptr1 = s1.data();
-  unsigned short * ptr2 = s2.data();
-
   RadarDataQueue queue;
 
   queue.push( PulseData(1.0, boresight, move(s1)) ); 
+  queue.push( PulseData(1.0, boresight, move(s2)) );
+  queue.pop();
+  queue.pop();
+  queue.pop();
 }
 
 
@@ -146,8 +190,8 @@ int main() {
 
   test_queue();
   test_empty();
+  test_full();
+  test_batch();
   assertThrow(test_empty_queue_exception(), logic_error);
-  assertThrow(test_pushed_initial_twice(), logic_error);
-  assertThrow(test_not_pushed_initial(), logic_error);
   return 0;
 }
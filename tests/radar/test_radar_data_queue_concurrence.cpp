@@ -26,17 +26,19 @@ void push_runner(RadarDataQueue * queue, bool * slow_push, bool * on) {
   while(*on) {
     if (*slow_push)
       slow_function();
-    queue->push( PulseData(sim_time, boresight, vector<unsigned short>(0)) );
+    PulseData pulse_data(sim_time, boresight, vector<unsigned short>(0));
+    while (!queue->push( move(pulse_data) ) && *on) //waits for the consumer when full
+      ;
     sim_time += dt;
   }
 
 }
 
 void test_concurrence(bool slow_pop, bool slow_push) {
-  RadarDataQueue queue;
+  RadarDataQueue queue(64);
   bool on = true;
 
-  queue.pushInitial( PulseData(-1.0, (math_vector){1.0, 1.0, 1.0}, vector<unsigned short>(0)) );
+  queue.push( PulseData(-1.0, (math_vector){1.0, 1.0, 1.0}, vector<unsigned short>(0)) );
 
   thread push_thread(push_runner, &queue, &slow_push, &on);
 
@@ -45,7 +47,7 @@ void test_concurrence(bool slow_pop, bool slow_push) {
 
   double sim_time = -1.1;
   while (data_count < max_count) {
-    if (queue.size() > 1) {
+    if (queue.size() > 0) {
       auto packet = queue.pop();
       data_count++;
       double old_time = sim_time;
@@ -60,10 +62,36 @@ void test_concurrence(bool slow_pop, bool slow_push) {
 }
 
 
+//the consumer sleeps in wait between pulses
+void test_wait(bool slow_push) {
+  RadarDataQueue queue(64);
+  bool on = true;
+
+  assertFalse( queue.wait(0.001) );
+  queue.push( PulseData(-1.0, (math_vector){1.0, 1.0, 1.0}, vector<unsigned short>(0)) );
+  assertTrue( queue.wait(0.001) );
+
+  thread push_thread(push_runner, &queue, &slow_push, &on);
+
+  double sim_time = -1.1;
+  for (int data_count = 0; data_count < 1000; data_count++) {
+    while (!queue.wait(0.1))
+      ;
+    double old_time = sim_time;
+    sim_time = queue.pop().getStartTime();
+    assertDoubleEqual(  sim_time - old_time, 0.1, 1e-4);
+  }
+  on = false;
+  push_thread.join();
+}
+
+
 int main() {
   test_concurrence(false, false);
   test_concurrence(false, true);
   test_concurrence(true, false);
   test_concurrence(true, true);
+  test_wait(false);
+  test_wait(true);
   return 0;
 }
@@ -0,0 +1,128 @@
+#include <math.h>
+
+#include <vector>
+#include <memory>
+#include <thread>
+
+#include <radsim/utils/assert.hpp>
+
+#include <radsim/mathematics/constants.hpp>
+#include <radsim/mathematics/fourier.hpp>
+
+#include <radsim/radar/radar_config.hpp>
+#include <radsim/radar/radar_config_parser.hpp>
+#include <radsim/radar/radar.hpp>
+#include <radsim/radar/radar_model.hpp>
+#include <radsim/radar/bandpass_filter.hpp>
+
+using namespace std;
+using namespace radsim;
+
+
+//identical configs share one model, it is released with the last owner
+void test_interning(const RadarConfig& config) {
+  int num_live = RadarModel::getNumLiveModels();
+
+  auto model = RadarModel::get(RadarModelKey(config));
+  assertIntEqual( RadarModel::getNumLiveModels(), num_live + 1 );
+  assertTrue( RadarModel::get(RadarModelKey(config)) == model );
+
+  RadarConfig other = config;
+  other.setPeakPower(2000); //not part of the model
+  assertTrue( RadarModel::get(RadarModelKey(other)) == model );
+
+  other.setBandWidth(8.0);
+  auto wide = RadarModel::get(RadarModelKey(other));
+  assertFalse( wide == model );
+  assertIntEqual( RadarModel::getNumLiveModels(), num_live + 2 );
+  assertDoubleEqual( wide->getKey().bandwidth, 8e6, 1e-6 );
+  wide.reset();
+  assertIntEqual( RadarModel::getNumLiveModels(), num_live + 1 );
+
+  {
+    Radar radar0(config);
+    Radar radar1(config);
+    assertIntEqual( RadarModel::getNumLiveModels(), num_live + 1 );
+  }
+  model.reset();
+  assertIntEqual( RadarModel::getNumLiveModels(), num_live );
+}
+
+
+//callers racing for the same key get one model, other keys are built alongside
+void test_concurrent_get(const RadarConfig& config) {
+  RadarConfig other = config;
+  other.setBandWidth(6.0);
+
+  const int num_threads = 4;
+  vector<shared_ptr<const RadarModel>> models(2 * num_threads);
+  vector<thread> threads;
+  for (int n = 0; n < num_threads; n++)
+    threads.emplace_back([&, n]() {
+      models[2 * n] = RadarModel::get(RadarModelKey(config));
+      models[2 * n + 1] = RadarModel::get(RadarModelKey(other));
+    });
+  for (auto& t : threads)
+    t.join();
+
+  for (int n = 1; n < num_threads; n++) {
+    assertTrue( models[2 * n] == models[0] );
+    assertTrue( models[2 * n + 1] == models[1] );
+  }
+  assertFalse( models[0] == models[1] );
+}
+
+
+//switching the simulated pulse does not overwrite the filtered pulse
+void test_sim_pulse(const RadarConfig& config) {
+  Radar radar(config);
+  double t = 1.5 * radar.getPulseWidth(); //s, after the emitted pulse
+  double filtered = radar.getFilteredPulse().output(t); //unit
+  assertTrue( filtered > 0 );
+
+  radar.setToUseFilteredPulse(false);
+  radar.setToUseFilteredPulse(true);
+  assertDoubleEqual( radar.getFilteredPulse().output(t), filtered, 1e-12 );
+
+  Radar copy = radar;
+  assertDoubleEqual( copy.getFilteredPulse().output(t), filtered, 1e-12 );
+  assertDoubleEqual( copy.getHorizontalBeamShape().output(0), 1, 1e-4 );
+}
+
+
+//the FFT filtered pulse agrees with direct evaluation of the fourier integrals over |f| < 3 / pulse_width
+void test_filtered_pulse(const RadarConfig& config) {
+  double pulse_width = config.getPulseWidth(); //s
+  auto model = RadarModel::get(RadarModelKey(config));
+  const auto& filter = model->getBandpassFilter(); //func(hz) = unit
+
+  int num_frequencies = 400;
+  double f_min = -3.0 / pulse_width; //hz
+  double df = 6.0 / pulse_width / num_frequencies; //hz
+  vector<double> frequency(num_frequencies); //hz
+  for (int k = 0; k < num_frequencies; k++)
+    frequency[k] = f_min + k * df; //hz
+  auto S = fourierTransform(model->getEmittedPulse(), frequency, pulse_width / 400, 0.0, pulse_width); //func(hz) = unit
+  vector<complex<double>> HS(num_frequencies);
+  for (int k = 0; k < num_frequencies; k++)
+    HS[k] = S.getValueVector()[k] * filter.output(frequency[k]);
+  ComplexApproxFunction modulated(frequency, HS); //func(hz) = unit
+
+  double peak = model->getFilteredPulse().output(0.5 * pulse_width); //unit
+  assertTrue( peak > 0.5 && peak < 1 );
+  for (double t = -2 * pulse_width; t < 3 * pulse_width; t += 0.1 * pulse_width) {
+    complex<double> direct = fourierTransformSingle(modulated, t, df, f_min, -f_min, true);
+    assertTrue( fabs(model->getFilteredPulse().output(t) - abs(direct)) < 5e-3 );
+  }
+}
+
+
+int main(int argc , char ** argv) {
+  const string config_file = string(argv[1]) + "/radar_configs/short_range_radar.txt";
+  RadarConfig config = RadarConfigParser().parseFile(config_file);
+  test_interning(config);
+  test_concurrent_get(config);
+  test_sim_pulse(config);
+  test_filtered_pulse(config);
+  return 0;
+}
@@ -0,0 +1,108 @@
+#include <vector>
+#include <memory>
+#include <fstream>
+#include <filesystem>
+
+#include <radsim/utils/assert.hpp>
+#include <radsim/utils/timer.hpp>
+
+#include <radsim/radar/radar_config.hpp>
+#include <radsim/radar/radar_config_parser.hpp>
+#include <radsim/radar/radar.hpp>
+#include <radsim/radar/radar_model.hpp>
+#include <radsim/radar/radar_model_cache.hpp>
+
+using namespace std;
+using namespace radsim;
+
+
+template <class T>
+void assertTableEqual(const ApproxFunction<T>& table, const ApproxFunction<T>& other) {
+  assertIntEqual( table.getEntryVector().size(), other.getEntryVector().size() );
+  assertTrue( table.getEntryVector() == other.getEntryVector() );
+  assertTrue( table.getValueVector() == other.getValueVector() );
+  assertTrue( table.getInitialValue() == other.getInitialValue() );
+  assertTrue( table.getEndValue() == other.getEndValue() );
+  assertTrue( table.getInterpolation() == other.getInterpolation() );
+}
+
+
+//a model built in one process is loaded in the next, with identical tables
+void test_store_load(const RadarConfig& config, const string& directory) {
+  RadarModelKey key(config);
+  RadarModelCache::setDirectory("");
+  assertTrue( RadarModelCache::getFilename(key).empty() );
+  assertTrue( RadarModelCache::load(key) == nullptr );
+
+  //the library version is part of the key
+  assertTrue( RadarModelCache::getLibraryVersion().find("1.0.0-") == 0 );
+
+  RadarModelCache::setDirectory(directory);
+  string filename = RadarModelCache::getFilename(key);
+  assertTrue( filename.find(directory) == 0 );
+  assertTrue( RadarModelCache::load(key) == nullptr );
+
+  shared_ptr<const RadarModel> built = RadarModel::get(key); //stored
+  assertTrue( filesystem::exists(filename) );
+
+  Timer timer;
+  shared_ptr<const RadarModel> loaded = RadarModelCache::load(key);
+  double load_time = timer.elapsed(); //s
+  cout << "load time (ms): " << 1e3 * load_time << endl;
+  assertTrue( loaded != nullptr );
+  assertTrue( loaded->getKey() == key );
+  assertTableEqual( loaded->getBandpassFilter(), built->getBandpassFilter() );
+  assertTableEqual( loaded->getEmittedPulse(), built->getEmittedPulse() );
+  assertTableEqual( loaded->getFilteredPulse(), built->getFilteredPulse() );
+  assertTableEqual( loaded->getHorizontalBeamShape(), built->getHorizontalBeamShape() );
+  assertTableEqual( loaded->getElevationBeamShape(), built->getElevationBeamShape() );
+
+  //a radar uses the cached tables
+  built.reset();
+  loaded.reset();
+  Radar radar(config);
+  assertTrue( radar.getFilteredPulse().getValueVector() == RadarModel(key).getFilteredPulse().getValueVector() );
+}
+
+
+//other keys have other files, and damaged files are rebuilt
+void test_mismatch(const RadarConfig& config, const string& directory) {
+  RadarModelCache::setDirectory(directory);
+  RadarConfig other = config;
+  other.setBandWidth(8.0);
+  RadarModelKey key(config);
+  RadarModelKey other_key(other);
+  assertFalse( RadarModelCache::hash(key) == RadarModelCache::hash(other_key) );
+  assertTrue( RadarModelCache::load(other_key) == nullptr );
+
+  //a file of the wrong key, under the name of key
+  auto other_model = RadarModel::get(other_key);
+  filesystem::copy_file(RadarModelCache::getFilename(other_key), RadarModelCache::getFilename(key),
+                        filesystem::copy_options::overwrite_existing);
+  assertTrue( RadarModelCache::load(key) == nullptr );
+
+  //a truncated file
+  filesystem::resize_file(RadarModelCache::getFilename(key), 100);
+  assertTrue( RadarModelCache::load(key) == nullptr );
+  {
+    ofstream ofs(RadarModelCache::getFilename(key), ios::trunc);
+  }
+  assertTrue( RadarModelCache::load(key) == nullptr );
+
+  assertTrue( RadarModelCache::store(RadarModel(key)) );
+  assertTrue( RadarModelCache::load(key) != nullptr );
+}
+
+
+int main(int argc , char ** argv) {
+  const string config_file = string(argv[1]) + "/radar_configs/short_range_radar.txt";
+  RadarConfig config = RadarConfigParser().parseFile(config_file);
+
+  string directory = (filesystem::temp_directory_path() / "radsim_test_model_cache").string();
+  filesystem::remove_all(directory);
+  test_store_load(config, directory);
+  test_mismatch(config, directory);
+  filesystem::remove_all(directory);
+  RadarModelCache::setDirectory("");
+  return 0;
+}
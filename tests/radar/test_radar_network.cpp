@@ -0,0 +1,114 @@
+#include <math.h>
+
+#include <vector>
+#include <memory>
+
+#include <radsim/utils/assert.hpp>
+
+#include <radsim/mathematics/math_vector.hpp>
+
+#include <radsim/radar/radar_config.hpp>
+#include <radsim/radar/radar_config_parser.hpp>
+#include <radsim/radar/radar.hpp>
+#include <radsim/radar/radar_network.hpp>
+
+using namespace std;
+using namespace radsim;
+
+
+shared_ptr<const TargetCollection> createTargets() {
+  auto targets = make_shared<TargetCollection>();
+  targets->emplace_back( math_vector{3000, 0, 0}, 10 );
+  targets->emplace_back( math_vector{0, 5000, 0}, 10 );
+  return targets;
+}
+
+
+//every radar generates the pulses of its own PRT, and the same pulses as a stand-alone radar
+void test_advance(const string& config_dir) {
+  RadarConfig fast = RadarConfigParser().parseFile(config_dir + "/short_range_radar.txt");
+  RadarConfig slow = RadarConfigParser().parseFile(config_dir + "/naval_radar.txt");
+  auto targets = createTargets();
+
+  RadarNetwork network(targets, 2);
+  assertIntEqual( network.getNumThreads(), 3 );
+  int i_fast = network.addRadar(fast);
+  int i_slow = network.addRadar(slow);
+  assertIntEqual( network.getNumRadars(), 2 );
+  network.setAddNoise(false);
+
+  double t = 0.01; //s
+  network.advance(t);
+  assertDoubleEqual( network.getSimTime(), t, 1e-12 );
+  double t_fast = network.getRadar(i_fast).getCurrentTime(); //s
+  double t_slow = network.getRadar(i_slow).getCurrentTime(); //s
+  assertTrue( t_fast >= t && t_fast < t + fast.getPRT() );
+  assertTrue( t_slow >= t && t_slow < t + slow.getPRT() );
+
+  Radar reference(fast);
+  reference.setToAddNoise(false);
+  int num_fast = 0;
+  while (network.dataReady(i_fast)) {
+    PulseData pulse = network.getData(i_fast);
+    PulseData expected = reference.generatePulseData(*targets);
+    assertDoubleEqual( pulse.getStartTime(), expected.getStartTime(), 1e-12 );
+    for (size_t n = 0; n < pulse.registry.size(); n++)
+      assertIntEqual( pulse.registry[n], expected.registry[n] );
+    num_fast++;
+  }
+  assertIntEqual( num_fast, round(t_fast / fast.getPRT()) );
+
+  int num_slow = 0;
+  while (network.dataReady(i_slow)) {
+    network.getData(i_slow);
+    num_slow++;
+  }
+  assertIntEqual( num_slow, round(t_slow / slow.getPRT()) );
+  assertIntEqual( network.getNumOverruns(i_slow), 0 );
+
+  //continues from where it stopped
+  network.advance(2 * t);
+  assertTrue( network.dataReady(i_slow) );
+  assertDoubleEqual( network.getData(i_slow).getStartTime(), t_slow, 1e-9 );
+
+  assertThrow( network.addRadar(fast), logic_error );
+  network.reset();
+  assertFalse( network.dataReady(i_slow) );
+  assertDoubleEqual( network.getRadar(i_slow).getCurrentTime(), 0, 1e-12 );
+  network.addRadar(slow);
+  assertIntEqual( network.getNumRadars(), 3 );
+}
+
+
+void test_start_stop(const string& config_dir) {
+  RadarConfig config = RadarConfigParser().parseFile(config_dir + "/naval_radar.txt");
+  IQRadarNetwork network(createTargets(), 1, 0.005);
+  for (int n = 0; n < 3; n++)
+    network.addRadar(config);
+
+  network.start();
+  assertThrow( network.start(), logic_error );
+  assertThrow( network.reset(), logic_error );
+  assertThrow( network.advance(1.0), logic_error );
+  while (network.getSimTime() < 0.02)
+    this_thread::yield();
+  network.stop();
+
+  for (int n = 0; n < 3; n++) {
+    assertTrue( network.dataReady(n) );
+    IQPulseData pulse = network.getData(n);
+    assertIntEqual( pulse.registry.size(), 2 * network.getRadar(n).getNumRangeBins() );
+  }
+}
+
+
+int main(int argc , char ** argv) {
+  const string config_dir = string(argv[1]) + "/radar_configs";
+  test_advance(config_dir);
+  test_start_stop(config_dir);
+
+  assertThrow( RadarNetwork(nullptr), invalid_argument );
+  assertThrow( RadarNetwork(createTargets(), 0, 0), invalid_argument );
+  assertThrow( RadarNetwork(createTargets(), 0).getData(0), invalid_argument );
+  return 0;
+}
@@ -0,0 +1,88 @@
+#include <vector>
+#include <memory>
+
+#include <radsim/utils/timer.hpp>
+#include <radsim/utils/assert.hpp>
+
+#include <radsim/mathematics/math_vector.hpp>
+
+#include <radsim/radar/radar_config.hpp>
+#include <radsim/radar/radar_config_parser.hpp>
+#include <radsim/radar/radar_network.hpp>
+
+using namespace std;
+using namespace radsim;
+
+
+shared_ptr<const TargetCollection> createTargets() {
+  auto targets = make_shared<TargetCollection>();
+  for (int n = 0; n < 20; n++)
+    targets->emplace_back( math_vector{1000.0 + 500 * n, 100.0 * n, 0}, 10 );
+  return targets;
+}
+
+
+double runNetwork(RadarNetwork& network, double t) {
+  network.reset();
+  Timer timer;
+  network.advance(t);
+  return timer.elapsed(); //s
+}
+
+
+//Radars with no pulses due cost nothing: a network of one fast radar and 30 radars with
+//long PRT takes about the time of the fast radar alone.
+void test_scaling(const string& config_dir) {
+  RadarConfig fast = RadarConfigParser().parseFile(config_dir + "/naval_radar.txt");
+  RadarConfig slow = RadarConfigParser().parseFile(config_dir + "/stationary_radar.txt");
+  double t = 0.5; //s
+
+  RadarNetwork single(createTargets());
+  single.addRadar(fast);
+  RadarNetwork mixed(createTargets());
+  mixed.addRadar(fast);
+  for (int n = 0; n < 30; n++)
+    mixed.addRadar(slow);
+
+  double alone = 1e9, network = 1e9; //s
+  for (int run = 0; run < 3; run++) {
+    alone = min(alone, runNetwork(single, t));
+    network = min(network, runNetwork(mixed, t));
+  }
+  cout << "1 radar (ms): " << 1e3 * alone << ", 1 + 30 slow radars (ms): " << 1e3 * network << endl;
+  assertTrue( network < 1.5 * alone + 0.01 );
+}
+
+
+//In real time, the simulation clock follows the wall clock.
+void test_real_time(const string& config_dir) {
+  RadarConfig config = RadarConfigParser().parseFile(config_dir + "/naval_radar.txt");
+  RadarNetwork network(make_shared<TargetCollection>());
+  for (int n = 0; n < 4; n++)
+    network.addRadar(config);
+
+  Timer timer;
+  network.start();
+  while (timer.elapsed() < 0.3)
+    this_thread::sleep_for(chrono::milliseconds(10));
+  double sim_time = network.getSimTime(); //s
+  double wall_time = timer.elapsed(); //s
+  network.stop();
+
+  cout << "wall time (s): " << wall_time << ", sim time (s): " << sim_time << endl;
+  assertDoubleEqual( sim_time, wall_time, 0.05 );
+  int num_pulses = 0;
+  while (network.dataReady(0)) {
+    network.getData(0);
+    num_pulses++;
+  }
+  assertDoubleEqual( num_pulses * config.getPRT(), sim_time, 0.05 );
+}
+
+
+int main(int argc , char ** argv) {
+  const string config_dir = string(argv[1]) + "/radar_configs";
+  test_scaling(config_dir);
+  test_real_time(config_dir);
+  return 0;
+}
@@ -156,6 +156,66 @@ void test_basic_signal(const RadarConfig& config) {
 }
 
 
+//Test that the I/Q target sample has the amplitude of the power sample, and the 
+//two-way phase -4 pi R / wavelength. A moving target shifts the phase from pulse to pulse,
+//unless doppler is turned off.
+void test_iq_signal(const RadarConfig& config) {
+  Radar radar( config );
+  double avg_noise = radar.getAvgNoise(); //W
+  radar.setToAddClutter(false);
+  radar.setUsePdf(false);
+  radar.setToAddNoise(false);
+  double wavelength = radar.getCarrierWavelength(); //m
+  double T = radar.getPRT(); //s
+
+  double signal_override = 40 * avg_noise; //W
+  double signal_amplitude = radar.getFilteredPulse().output(0) * powerToAmp(signal_override); //amp
+  short digital_amplitude = radar.getADC().convertAmplitude(signal_amplitude);
+
+  int bin_index = 253; 
+  double base_distance = radar.getRange(bin_index); //m
+  TargetCollection targets;
+  targets.emplace_back( (math_vector){base_distance, 0, 0}, 1.0 );
+
+  IQPulseData pulse_data = radar.generateIQPulseData(targets, true, signal_override);
+  const auto& registry = pulse_data.registry;
+  assertTrue( pulse_data.hasOriginalRegistry() );
+  assertIntEqual( registry.size(), 2 * radar.getNumRangeBins() );
+  double I = registry[2 * 253]; //unit
+  double Q = registry[2 * 253 + 1]; //unit
+  assertDoubleEqual( sqrt(I * I + Q * Q), digital_amplitude, 1e-2 );
+  double phase = - 4 * pi * base_distance / wavelength; //rad
+  assertDoubleEqual( I, digital_amplitude * cos(phase), 2.0 / digital_amplitude );
+  assertDoubleEqual( Q, digital_amplitude * sin(phase), 2.0 / digital_amplitude );
+  assertIntEqual( registry[2 * 200], 0 );
+  assertIntEqual( registry[2 * 200 + 1], 0 );
+
+  //target moving wavelength/16 per pulse => doppler phase shift of -pi/4 per pulse.
+  double dx = wavelength / 16; //m
+  vector<double> time_entry = {0.0, T, 2 * T};
+  vector<math_vector> pos_entry = { {base_distance, 0, 0}, {base_distance + dx, 0, 0}, {base_distance + 2 * dx, 0, 0} };
+  targets.clear();
+  targets.emplace_back( VectorApproxFunction(time_entry, pos_entry), 1.0 );
+
+  radar.reset();
+  IQPulseData pulse_data0 = radar.generateIQPulseData(targets, true, signal_override);
+  IQPulseData pulse_data1 = radar.generateIQPulseData(targets, true, signal_override);
+  double phase0 = atan2( pulse_data0.registry[2 * 253 + 1], pulse_data0.registry[2 * 253] ); //rad
+  double phase1 = atan2( pulse_data1.registry[2 * 253 + 1], pulse_data1.registry[2 * 253] ); //rad
+  double shift = phase1 - phase0; //rad
+  setRadDefaultRange(shift);
+  assertDoubleEqual( shift, 1.75 * pi, 1e-2 );
+
+  radar.setToAddDoppler(false);
+  assertFalse( radar.getToAddDoppler() );
+  radar.reset();
+  pulse_data0 = radar.generateIQPulseData(targets, true, signal_override);
+  pulse_data1 = radar.generateIQPulseData(targets, true, signal_override);
+  assertIntEqual( pulse_data0.registry[2 * 253], pulse_data1.registry[2 * 253] );
+  assertIntEqual( pulse_data0.registry[2 * 253 + 1], pulse_data1.registry[2 * 253 + 1] );
+}
+
+
 //Test signal from target beyond unambiguous range
 /*
                                                                                      Target
@@ -212,8 +272,8 @@ void test_ambiguous_range(RadarConfig config) {
   assertIntEqual( radar.getCurrentCarrySize(), 2 );
   const auto& packet2 = pulse2.registry;
   assertIntEqual( packet2[200], 0 );
-  assertIntEqual( packet2[253], 658 );
-  assertIntEqual( packet2[254], 658 );
+  assertIntEqual( packet2[253], 657 );
+  assertIntEqual( packet2[254], 657 );
   assertIntEqual( packet2[400], 0 );
   //And also in Pulse 3
   PulseData pulse3 = radar.generatePulseData(targets, true, 40 * avg_noise);
@@ -544,6 +604,7 @@ int main(int argc , char ** argv) {
   RadarConfig config = parser.parseFile(config_file);
   test_unfiltered_signal(config);
   test_basic_signal(config);
+  test_iq_signal(config);
   test_ambiguous_range(config);
   test_angle_offset(config);
   test_phase_and_multiple_targets(config);
@@ -0,0 +1,109 @@
+#include <vector>
+#include <memory>
+#include <thread>
+
+#include <radsim/utils/assert.hpp>
+
+#include <radsim/radar/pulse_data.hpp>
+#include <radsim/radar/radar_data_queue.hpp>
+#include <radsim/radar/registry_pool.hpp>
+
+using namespace std;
+using namespace radsim;
+
+typedef vector<unsigned short> registry;
+
+
+void test_pool() {
+  RegistryPool<unsigned short> pool(2);
+  assertIntEqual( pool.getCapacity(), 2 );
+
+  //nothing held yet
+  registry b1 = pool.acquire();
+  assertIntEqual( b1.capacity(), 0 );
+  assertIntEqual( pool.getNumMisses(), 1 );
+
+  b1.resize(10);
+  const unsigned short * ptr1 = b1.data();
+  pool.release( move(b1) );
+  registry b2 = pool.acquire();
+  assertTrue( b2.data() == ptr1 );
+  assertIntEqual( pool.getNumMisses(), 1 );
+
+  //buffers beyond the capacity are not held
+  pool.release( registry(10) );
+  pool.release( registry(10) );
+  pool.release( move(b2) );
+  assertIntEqual( pool.acquire().size(), 10 );
+  assertIntEqual( pool.acquire().size(), 10 );
+  assertIntEqual( pool.acquire().size(), 0 );
+  assertIntEqual( pool.getNumMisses(), 2 );
+
+  //empty buffers are not held
+  pool.release( registry() );
+  assertIntEqual( pool.acquire().capacity(), 0 );
+
+  assertThrow( RegistryPool<unsigned short>(0), invalid_argument );
+}
+
+
+void test_pooled_pulse_data() {
+  auto pool = make_shared<RegistryPool<unsigned short>>(4);
+  math_vector boresight = {1, 0, 0};
+
+  const unsigned short * ptr;
+  {
+    PooledPulseData<unsigned short> pulse( PulseData(1.0, boresight, registry(5, 3)), pool );
+    ptr = pulse->registry.data();
+    assertDoubleEqual( (*pulse).getStartTime(), 1.0, 1e-12 );
+    assertIntEqual( pulse->registry[4], 3 );
+
+    PooledPulseData<unsigned short> moved( move(pulse) );
+    assertTrue( moved->registry.data() == ptr );
+  }
+  assertTrue( pool->acquire().data() == ptr );
+
+  //assignment returns the old registry
+  PooledPulseData<unsigned short> a( PulseData(1.0, boresight, registry(5)), pool );
+  const unsigned short * ptr_a = a->registry.data();
+  a = PooledPulseData<unsigned short>( PulseData(2.0, boresight, registry(5)), pool );
+  assertTrue( pool->acquire().data() == ptr_a );
+}
+
+
+//the producer acquires, the consumer releases, the buffers circulate
+void test_concurrence() {
+  auto pool = make_shared<RegistryPool<unsigned short>>(64);
+  RadarDataQueue queue(16);
+  math_vector boresight = {1, 0, 0};
+  int num_pulses = 20000;
+
+  thread producer([&]() {
+    for (int n = 0; n < num_pulses; n++) {
+      registry reg = pool->acquire();
+      reg.assign(8, n % 1000);
+      PulseData pulse(n, boresight, move(reg));
+      while (!queue.push( move(pulse) ))
+        ;
+    }
+  });
+
+  for (int n = 0; n < num_pulses; n++) {
+    while (!queue.wait(0.1))
+      ;
+    PooledPulseData<unsigned short> pulse( queue.pop(), pool );
+    assertIntEqual( pulse->registry[7], n % 1000 );
+  }
+  producer.join();
+
+  //only the buffers in flight at most were allocated
+  assertTrue( pool->getNumMisses() <= 16 + 2 );
+}
+
+
+int main() {
+  test_pool();
+  test_pooled_pulse_data();
+  test_concurrence();
+  return 0;
+}
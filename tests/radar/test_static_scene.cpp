@@ -0,0 +1,138 @@
+#include <math.h>
+
+#include <vector>
+#include <cstdlib>
+
+#include <radsim/utils/assert.hpp>
+
+#include <radsim/mathematics/constants.hpp>
+#include <radsim/mathematics/math_vector.hpp>
+
+#include <radsim/radar/radar_config.hpp>
+#include <radsim/radar/radar_config_parser.hpp>
+#include <radsim/radar/radar.hpp>
+#include <radsim/radar/static_scene_cache.hpp>
+
+using namespace std;
+using namespace radsim;
+
+
+void test_slots() {
+  double step = 2 * pi / 8; //rad
+  StaticSceneCache cache(step, 0.5);
+  assertIntEqual( cache.getNumSlots(), 8 );
+  assertIntEqual( cache.findSlot(0.5), 0 );
+  assertIntEqual( cache.findSlot(0.5 + 3 * step + 1e-9), 3 );
+  assertIntEqual( cache.findSlot(0.5 + 11 * step), 3 ); //next rotation
+  assertIntEqual( cache.findSlot(0.5 - 2 * step), 6 ); //counter-clockwise
+
+  assertFalse( cache.isCached(3) );
+  cache.setEchoes(3, {StaticEcho(10, 1.0, 1.0)});
+  assertTrue( cache.isCached(3) );
+  assertIntEqual( cache.getNumCachedSlots(), 1 );
+  assertIntEqual( cache.getEchoes(3)[0].bin, 10 );
+  cache.clear();
+  assertIntEqual( cache.getNumCachedSlots(), 0 );
+
+  assertIntEqual( StaticSceneCache(0, 0).getNumSlots(), 1 ); //fixed antenna
+}
+
+
+//a rotation of 10.3 or 10.7 pulses, the slot stays within half a pulse step of the antenna over many rotations
+void test_slots_non_integer() {
+  double init_theta = 0.5; //rad
+  for (double pulses_per_rotation : {10.3, 10.7})
+  for (double sense : {1.0, -1.0}) {
+    double step = 2 * pi / pulses_per_rotation; //rad
+    StaticSceneCache cache(sense * step, init_theta);
+    assertIntEqual( cache.getNumSlots(), 11 );
+    for (int p = 0; p < 200; p++) {
+      double theta = init_theta + sense * p * step; //rad
+      int slot = cache.findSlot(theta);
+      assertTrue( slot >= 0 && slot < 11 );
+      double error = remainder(theta - (init_theta + slot * step), 2 * pi); //rad
+      assertTrue( fabs(error) <= 0.5 * step + 1e-9 );
+    }
+  }
+}
+
+
+//buoys around the radar, in the pulse directions, plus one beyond unambiguous range
+TargetCollection createBuoys(double step) {
+  TargetCollection buoys;
+  for (int k = 0; k < 64; k += 3) {
+    double theta = k * step; //rad
+    double distance = 2000 + 100 * k; //m
+    buoys.emplace_back( math_vector{distance * cos(theta), distance * sin(theta), 0}, 1e-3 );
+  }
+  buoys.emplace_back( math_vector{25000, 0, 0}, 10 );
+  return buoys;
+}
+
+
+//the cached scene gives the same pulses as the same targets passed to every pulse
+void test_replay(const RadarConfig& config) {
+  int num_slots = 64;
+  double step = 2 * pi / num_slots; //rad
+  TargetCollection buoys = createBuoys(step);
+
+  Radar cached(config);
+  Radar plain(config);
+  for (Radar * radar : {&cached, &plain}) {
+    radar->setToAddNoise(false);
+    radar->setAntRotSpeed(step / radar->getPRT());
+  }
+  cached.setStaticTargets(buoys);
+  assertIntEqual( cached.getNumStaticTargets(), buoys.size() );
+  assertIntEqual( cached.getNumStaticCacheSlots(), num_slots );
+  assertIntEqual( cached.getNumCachedStaticSlots(), 0 );
+
+  int num_echo_bins = 0;
+  for (int p = 0; p < 2 * num_slots; p++) {
+    PulseData pulse = cached.generatePulseData();
+    PulseData expected = plain.generatePulseData(buoys);
+    for (size_t n = 0; n < pulse.registry.size(); n++) {
+      assertTrue( abs(pulse.registry[n] - expected.registry[n]) <= 1 );
+      if (expected.registry[n] > 0)
+        num_echo_bins++;
+    }
+    if (p < num_slots)
+      assertIntEqual( cached.getNumCachedStaticSlots(), p + 1 );
+  }
+  assertIntEqual( cached.getNumCachedStaticSlots(), num_slots );
+  assertTrue( num_echo_bins > 40 );
+
+  for (int p = 0; p < num_slots; p++) {
+    IQPulseData pulse = cached.generateIQPulseData();
+    IQPulseData expected = plain.generateIQPulseData(buoys);
+    for (size_t n = 0; n < pulse.registry.size(); n++)
+      assertTrue( abs(pulse.registry[n] - expected.registry[n]) <= 1 );
+  }
+
+  //the cache follows the antenna
+  cached.setAntRotSpeed(2 * step / cached.getPRT());
+  assertIntEqual( cached.getNumStaticCacheSlots(), num_slots / 2 );
+  assertIntEqual( cached.getNumCachedStaticSlots(), 0 );
+
+  cached.clearStaticTargets();
+  assertIntEqual( cached.getNumStaticTargets(), 0 );
+  cached.reset();
+  PulseData pulse = cached.generatePulseData();
+  for (auto sample : pulse.registry)
+    assertIntEqual( sample, 0 );
+}
+
+
+int main(int argc , char ** argv) {
+
+  test_slots();
+  test_slots_non_integer();
+
+  const string config_file = string(argv[1]) + "/radar_configs/short_range_radar.txt";
+  RadarConfig config = RadarConfigParser().parseFile(config_file);
+  test_replay(config);
+
+  assertThrow( StaticSceneCache(0.1, 0).getEchoes(0), logic_error );
+  assertThrow( StaticSceneCache(0.1, 0).setEchoes(100, {}), invalid_argument );
+  return 0;
+}
@@ -42,11 +42,9 @@ void test_move() {
   VectorApproxFunction path({0, 1}, vector<math_vector>{start, end});
 
   Target target(move(path), 8.0);  
-  const void * ptr_entry = target.getPath().getEntryVector().data();
   const void * ptr_array = target.getPath().getValueVector()[0].data();
 
   Target copy = move(target);
-  assertTrue( ptr_entry == copy.getPath().getEntryVector().data() );
   assertTrue( ptr_array == copy.getPath().getValueVector()[0].data() );
 
 }
@@ -0,0 +1,145 @@
+#include <vector>
+#include <cmath>
+#include <thread>
+
+#include <radsim/utils/assert.hpp>
+
+#include <radsim/mathematics/math_vector.hpp>
+
+#include <radsim/radar/trajectory.hpp>
+#include <radsim/radar/target.hpp>
+
+using namespace std;
+using namespace radsim;
+
+
+void test_output() {
+  Trajectory track({0.0, 1.0, 3.0}, {{0, 0, 0}, {10, 0, 0}, {10, 20, 0}});
+  assertIntEqual( track.getNumPoints(), 3 );
+  assertTrue( track.output(-1.0) == (math_vector{0, 0, 0}) );
+  assertTrue( track.output(0.5) == (math_vector{5, 0, 0}) );
+  assertTrue( track.output(2.0) == (math_vector{10, 10, 0}) );
+  assertTrue( track.output(4.0) == (math_vector{10, 20, 0}) );
+
+  //back in time, after the cursor has moved on
+  assertTrue( track.output(0.25) == (math_vector{2.5, 0, 0}) );
+
+  Trajectory point({5.0}, {{1, 2, 3}});
+  assertTrue( point.output(0) == (math_vector{1, 2, 3}) );
+  assertTrue( point.output(9) == (math_vector{1, 2, 3}) );
+}
+
+
+//a track sampled at irregular times, compared with the exact path at increasing and random times
+void test_irregular() {
+  auto exact = [](double t) { return math_vector{100 * t, 50 * sin(0.1 * t), 0}; };
+  vector<double> time;
+  vector<math_vector> position;
+  double t = 0;
+  for (int n = 0; n < 20000; n++) {
+    time.push_back(t);
+    position.push_back(exact(t));
+    t += 0.05 + 0.1 * ((n * 7919) % 13) / 13.0;
+  }
+  t = time.back();
+  Trajectory track(time, position);
+  assertIntEqual( track.getNumPoints(), 20000 );
+
+  size_t cursor = 0;
+  for (double s = 0.01; s < t; s += 0.01) {
+    assertTrue( math_vector_length(track.output(s, cursor) - exact(s)) < 0.01 );
+    assertTrue( time[cursor] <= s && s < time[cursor + 1] );
+  }
+  for (int n = 0; n < 1000; n++) {
+    double s = ((n * 104729) % 1000) * t / 1000;
+    assertTrue( math_vector_length(track.output(s) - exact(s)) < 0.01 );
+    assertTrue( math_vector_length(track.output(s, cursor) - exact(s)) < 0.01 );
+  }
+}
+
+
+void test_simplify() {
+  //a straight leg at constant speed is reduced to its end points
+  vector<double> time;
+  vector<math_vector> position;
+  for (int n = 0; n <= 100; n++) {
+    time.push_back(n);
+    position.push_back({2.0 * n, 0, 0});
+  }
+  Trajectory straight(time, position, 0.1);
+  assertIntEqual( straight.getNumPoints(), 2 );
+  assertTrue( straight.output(50) == (math_vector{100, 0, 0}) );
+
+  //the same route at changing speed keeps the turn in speed
+  for (int n = 50; n <= 100; n++)
+    position[n] = {100 + 4.0 * (n - 50), 0, 0};
+  Trajectory accelerating(time, position, 0.1);
+  assertIntEqual( accelerating.getNumPoints(), 3 );
+
+  //a curved track is kept within tolerance at every input point
+  auto exact = [](double t) { return math_vector{1000 * cos(0.01 * t), 1000 * sin(0.01 * t), 0}; };
+  for (int n = 0; n <= 100; n++)
+    position[n] = exact(n);
+  Trajectory curve(time, position, 1.0);
+  assertTrue( curve.getNumPoints() < 50 );
+  for (int n = 0; n <= 100; n++)
+    assertTrue( math_vector_length(curve.output(n) - position[n]) <= 1.0 );
+}
+
+
+void test_threads() {
+  vector<double> time;
+  vector<math_vector> position;
+  for (int n = 0; n < 1000; n++) {
+    time.push_back(n * 0.5);
+    position.push_back({n * 1.0, 0, 0});
+  }
+  //targets sharing the trajectory, each with its own cursor
+  Target target(Trajectory(time, position), 1.0);
+  Target copy = target;
+  Target * targets[2] = {&target, &copy};
+  bool correct[2] = {true, true};
+  auto sweep = [&](int id) {
+    for (int rep = 0; rep < 20; rep++)
+      for (double t = 0; t < 499; t += 0.3)
+        if (!double_equal(targets[id]->getPosition(t)[0], 2 * t, 1e-9) && t > 0)
+          correct[id] = false;
+  };
+  thread other(sweep, 1);
+  sweep(0);
+  other.join();
+  assertTrue( correct[0] && correct[1] );
+}
+
+
+void test_target() {
+  Trajectory track({0.0, 10.0}, {{0, 0, 0}, {100, 0, 0}});
+  Target target(track, 8.0);
+  assertTrue( target.hasTrajectory() );
+  assertTrue( target.getPosition(5) == (math_vector{50, 0, 0}) );
+  assertIntEqual( target.getTrajectory().getNumPoints(), 2 );
+  assertThrow( target.getPath(), std::logic_error );
+
+  Target copy = target;
+  assertTrue( &copy.getTrajectory() == &target.getTrajectory() );
+
+  target.setPosition({1, 2, 3});
+  assertFalse( target.hasTrajectory() );
+  assertTrue( target.getPosition(5) == (math_vector{1, 2, 3}) );
+  assertTrue( copy.getPosition(10) == (math_vector{100, 0, 0}) );
+}
+
+
+int main(int argc, char** argv) {
+  test_output();
+  test_irregular();
+  test_simplify();
+  test_threads();
+  test_target();
+
+  assertThrow( Trajectory({}, {}), std::invalid_argument );
+  assertThrow( Trajectory({0.0, 1.0}, {{0, 0, 0}}), std::invalid_argument );
+  assertThrow( Trajectory({0.0, 0.0}, {{0, 0, 0}, {1, 0, 0}}), std::invalid_argument );
+  assertThrow( Trajectory({0.0, 1.0}, {{0, 0, 0}, {1, 0, 0}}, -1.0), std::invalid_argument );
+  return 0;
+}
@@ -51,12 +51,30 @@ void test_rng_custom() {
   assertTrue( g.output() == 0.00 );
 }
 
+//reference output of splitmix64 from state 0, 0xe220a8397b1dcdaf
+void test_rng_splitmix64() {
+  RNG g(0, &RNG::splitmix64);
+  assertTrue( g.output() == (0xe220a8397b1dcdafULL >> 11) * 0x1.0p-53 );
+
+  g.setSeed(0);
+  assertTrue( g.output() == (0xe220a8397b1dcdafULL >> 11) * 0x1.0p-53 );
+}
+
+//setSeed keeps a custom function
+void test_rng_set_seed() {
+  RNG g(true, 0, &random_func2);
+  g.setSeed(2);
+  assertTrue( g.output() == 0.50 );
+}
+
 int main() {
 
   test_rng_default();
   test_rng_seeded(512);
   test_rng_set_rand_r(435);
   test_rng_custom();
+  test_rng_splitmix64();
+  test_rng_set_seed();
 
   return 0;
 }
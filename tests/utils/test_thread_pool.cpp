@@ -0,0 +1,51 @@
+#include <vector>
+#include <atomic>
+
+#include <radsim/utils/assert.hpp>
+#include <radsim/utils/thread_pool.hpp>
+
+using namespace std;
+using namespace radsim;
+
+
+void test_parallel_for(int num_threads) {
+  ThreadPool pool(num_threads);
+  assertIntEqual( pool.getNumThreads(), num_threads + 1 );
+
+  size_t N = 1000;
+  vector<int> hits(N, 0);
+  atomic<long> sum(0);
+  pool.parallelFor(0, N, [&](size_t n) {
+    hits[n]++;
+    sum += n;
+  });
+  for (size_t n = 0; n < N; n++)
+    assertIntEqual( hits[n], 1 );
+  assertTrue( sum.load() == (long) (N * (N - 1) / 2) );
+
+  //repeated loops, and loops with fewer indices than threads
+  for (int loop = 0; loop < 100; loop++)
+    pool.parallelFor(10, 13, [&](size_t n) { hits[n]++; });
+  assertIntEqual( hits[9], 1 );
+  assertIntEqual( hits[10], 101 );
+  assertIntEqual( hits[12], 101 );
+  assertIntEqual( hits[13], 1 );
+
+  pool.parallelFor(5, 5, [&](size_t n) { hits[n]++; });
+  assertIntEqual( hits[5], 1 );
+
+  //one index at a time
+  pool.parallelFor(0, N, [&](size_t n) { hits[n]++; }, 1);
+  for (size_t n = 0; n < N; n++)
+    assertTrue( hits[n] >= 2 );
+  assertIntEqual( hits[0], 2 );
+  assertIntEqual( hits[10], 102 );
+}
+
+
+int main() {
+  test_parallel_for(0);
+  test_parallel_for(1);
+  test_parallel_for(4);
+  return 0;
+}
@@ -32,7 +32,33 @@ void test_timer() {
 }
 
 
+//sleeps most of the interval, and returns at the deadline
+void test_sleep_until() {
+
+  double test_time = 0.5; //s
+
+  Timer timer;
+  clock_t cpu_start = clock();
+  timer.sleepUntil(test_time);
+  double cpu_time = double(clock() - cpu_start) / CLOCKS_PER_SEC; //s
+  double time_elapsed = timer.elapsed();
+
+  assertTrue( time_elapsed >= test_time );
+  assertTrue( time_elapsed < test_time + 1e-3 );
+  assertTrue( cpu_time < 0.1 * test_time );
+
+  //a passed deadline returns at once
+  timer.sleepUntil(0.1);
+  assertTrue( timer.elapsed() < test_time + 2e-3 );
+
+  //no slack, only sleep
+  timer.sleepUntil(2 * test_time, 0);
+  assertTrue( timer.elapsed() >= 2 * test_time );
+}
+
+
 int main() {
   test_timer();
+  test_sleep_until();
   return 0;
 }